@@ -8,6 +8,8 @@
 #include "AcousticsData.h"
 #include "AcousticsSpace.generated.h"
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FAcousticsDataLoadedSignature, bool, Success);
+
 UCLASS(
     config = Engine, hidecategories = Auto, AutoExpandCategories = Acoustics, BlueprintType, Blueprintable,
     ClassGroup = Acoustics)
@@ -21,6 +23,17 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustics")
     UAcousticsData* AcousticsData;
 
+    /** If enabled, the ACE file is loaded on a worker thread at BeginPlay so the level doesn't wait for it.
+     * Sounds play without acoustics until loading finishes and OnAcousticsDataLoaded is broadcast.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Acoustics")
+    bool LoadAsync;
+
+    /** Broadcast when the ACE file has finished loading, with true on success.
+     */
+    UPROPERTY(BlueprintAssignable, Category = "Acoustics")
+    FAcousticsDataLoadedSignature OnAcousticsDataLoaded;
+
     /** Tile size for streaming acoustic data. Probes within this tile centered at player are kept loaded in RAM.
      * Small tile size will reduce RAM but at cost of frequent loading. Huge sizes containing all probes will load
      * full data into RAM. Unless tile is too small to keep up with player motion, acoustics is unaffected by tile size.
@@ -43,6 +56,15 @@ public:
         meta = (UIMin = 0, ClampMin = 0, UIMax = 1, ClampMax = 1))
     float CacheScale;
 
+    /** Memory budget for acoustics in MB. Overrides PA.MemoryBudgetMB when set, 0 falls back to it.
+     * In budget mode, TileSize and CacheScale are only starting points: the horizontal tile size is
+     * adjusted from the observed probe density and memory use, shrinking while over budget and
+     * growing back when there is headroom. CacheScale is lowered at load time if the fixed cost of
+     * the ACE file would take too much of the budget.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Acoustics", meta = (UIMin = 0, ClampMin = 0))
+    float MemoryBudgetMB;
+
     /** Will update distance data around listener location at each tick.
      * The distance data is retrievable in blueprint/code
      */
@@ -156,6 +178,16 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Acoustics")
     bool LoadAcousticsData(UAcousticsData* newBake);
 
+    /** Same as LoadAcousticsData, but returns immediately and loads on a worker thread.
+        OnAcousticsDataLoaded is broadcast once loading finishes. Returns false if the load couldn't be started. */
+    UFUNCTION(BlueprintCallable, Category = "Acoustics")
+    bool LoadAcousticsDataAsync(UAcousticsData* newBake);
+
+    /** Returns true if acoustic data is loaded and no load is in progress.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Acoustics")
+    bool IsAcousticsDataReady() const;
+
     /** Get distance from listener looking in given direction using an internal
      * baked distance map that is updated if UpdateDistances is true.
      * The value is smoothed over a cone and precomputed, so it is not sensitive
@@ -182,6 +214,11 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Acoustics")
     void SetAcousticsEnabled(bool isEnabled);
 
+    /** Tile size currently used for streaming. Same as TileSize unless a memory budget is set.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Acoustics")
+    FVector GetStreamingTileSize() const;
+
     // AActor methods
     void BeginPlay() override;
     void Tick(float deltaSeconds) override;
@@ -193,9 +230,23 @@ public:
 private:
     // Helper to convert from UAcousticsData to a real filepath that Triton can load
     bool LoadAceFile(FString filePath);
+    bool LoadAceFileAsync(FString filePath);
+    void HandleAceFileLoaded(bool success, FString filePath, bool allowBudgetReload);
+    // Streams in the first tile and notifies listeners once an ACE file load has finished
+    bool FinishAceFileLoad(const FString& filePath, bool success);
+    // Budget mode: cache scale the ACE file should be reloaded with to fit the budget, or 0 if it already fits
+    float GetBudgetCacheScale();
     FVector GetListenerPosition();
+    // Budget in effect, from MemoryBudgetMB or PA.MemoryBudgetMB. 0 when budget mode is off.
+    float GetMemoryBudgetMB() const;
+    // Budget mode: resizes the streamed tile from observed memory use. Returns true if the size changed.
+    bool UpdateBudgetTileSize();
     TArray<TritonWwiseParams> m_PluginData;
     class IAcoustics* m_Acoustics;
+    FVector m_BudgetTileSize;
+    // Memory used right after loading the ACE file, before any probes are streamed in
+    int64 m_BudgetBaselineMemory;
+    float m_LastBudgetUpdateTime;
 
 #if !UE_BUILD_SHIPPING
 private:
@@ -10,6 +10,7 @@
 #include <Classes/Engine/Font.h>
 #include <Classes/Engine/Canvas.h>
 #include "Engine/Engine.h"
+#include "Engine/World.h"
 
 using namespace TritonRuntime;
 
@@ -23,6 +24,9 @@ static constexpr float c_DynamicOpeningBoxSize = 5.0f;
 static constexpr float c_TextScale = 1.0f;
 static constexpr float c_DebugVerbosity = 2;
 static constexpr float c_SpeedOfSound = 340.0f;
+// Size of the cell the camera can move within before the voxel cache is rebuilt,
+// as a fraction of the voxel visible distance
+static constexpr float c_VoxelCacheCellFraction = 0.5f;
 
 // Draws formatted text next to a 3D location, in screen space.
 class FDebugMultiLinePrinter
@@ -401,6 +405,8 @@ bool FProjectAcousticsDebugRender::Render(
 void FProjectAcousticsDebugRender::SetLoadedFilename(FString fileName)
 {
     m_LoadedFilename = fileName;
+    // New data, cached voxels no longer apply
+    m_IsVoxelCacheValid = false;
 }
 
 void FProjectAcousticsDebugRender::DrawStats()
@@ -420,6 +426,10 @@ void FProjectAcousticsDebugRender::DrawStats()
             Panel.DrawText(
                 FString::Printf(TEXT("Loaded: %s [%d probes]"), *m_LoadedFilename, probeCount), FColor::White);
         }
+        else if (m_Acoustics->IsAceFileLoadPending())
+        {
+            Panel.DrawText(FString::Printf(TEXT("Loading...")), FColor::Yellow);
+        }
         else
         {
             Panel.DrawText(FString::Printf(TEXT("Loaded: None")), FColor::Red);
@@ -435,9 +445,10 @@ void FProjectAcousticsDebugRender::DrawStats()
         FColor::White);
 }
 
-// Normal needs to point in an axis-aligned direction. Undefined behavior otherwise.
-void FProjectAcousticsDebugRender::DrawDebugAARectangle(
-    const UWorld* inWorld, const FVector& faceCenter, const FVector& faceSize, AAFaceDirection dir, const FColor& color)
+// Computes the four corners of an axis-aligned face, in winding order.
+// Normal needs to point in an axis-aligned direction. Returns false otherwise.
+static bool GetAARectangleCorners(
+    const FVector& faceCenter, const FVector& faceSize, AAFaceDirection dir, FVector (&outCorners)[4])
 {
     FVector offset = faceSize * 0.5f;
     FVector minCorner, dv1, dv2;
@@ -463,50 +474,107 @@ void FProjectAcousticsDebugRender::DrawDebugAARectangle(
             dv2 = FVector(0, faceSize.Y, 0);
             break;
         default:
-            return;
+            return false;
     }
 
-    FVector corner1 = minCorner + dv1;
-    FVector corner2 = minCorner + dv1 + dv2;
-    FVector corner3 = minCorner + dv2;
+    outCorners[0] = minCorner;
+    outCorners[1] = minCorner + dv1;
+    outCorners[2] = minCorner + dv1 + dv2;
+    outCorners[3] = minCorner + dv2;
+    return true;
+}
 
-    DrawDebugLine(inWorld, minCorner, corner1, color);
-    DrawDebugLine(inWorld, corner1, corner2, color);
-    DrawDebugLine(inWorld, corner2, corner3, color);
-    DrawDebugLine(inWorld, corner3, minCorner, color);
+// Normal needs to point in an axis-aligned direction. Undefined behavior otherwise.
+void FProjectAcousticsDebugRender::DrawDebugAARectangle(
+    const UWorld* inWorld, const FVector& faceCenter, const FVector& faceSize, AAFaceDirection dir, const FColor& color)
+{
+    FVector corners[4];
+    if (!GetAARectangleCorners(faceCenter, faceSize, dir, corners))
+    {
+        return;
+    }
+
+    DrawDebugLine(inWorld, corners[0], corners[1], color);
+    DrawDebugLine(inWorld, corners[1], corners[2], color);
+    DrawDebugLine(inWorld, corners[2], corners[3], color);
+    DrawDebugLine(inWorld, corners[3], corners[0], color);
+}
+
+void FProjectAcousticsDebugRender::AddAARectangleLines(
+    TArray<FBatchedLine>& outLines, const FVector& faceCenter, const FVector& faceSize, AAFaceDirection dir,
+    const FColor& color, float lifeTime)
+{
+    FVector corners[4];
+    if (!GetAARectangleCorners(faceCenter, faceSize, dir, corners))
+    {
+        return;
+    }
+
+    for (int i = 0; i < 4; i++)
+    {
+        outLines.Emplace(corners[i], corners[(i + 1) % 4], color, lifeTime, 0.0f, SDPG_World);
+    }
 }
 
 void FProjectAcousticsDebugRender::DrawVoxels()
 {
-    if (!m_Acoustics->IsAceFileLoaded())
+    if (!m_Acoustics->IsAceFileLoaded() || m_World->LineBatcher == nullptr)
+    {
+        return;
+    }
+
+    // The voxel surface is only re-extracted when the camera moves into a different cache cell.
+    // The extracted region is padded by half a cell, so the visible distance is covered from
+    // anywhere inside the current cell.
+    const auto cacheCellSize = FMath::Max(c_VoxelCacheCellFraction * m_VoxelVisibleDistance, 1.0f);
+    const auto cacheCell = FIntVector(
+        FMath::FloorToInt(m_CameraPos.X / cacheCellSize),
+        FMath::FloorToInt(m_CameraPos.Y / cacheCellSize),
+        FMath::FloorToInt(m_CameraPos.Z / cacheCellSize));
+
+    if (!m_IsVoxelCacheValid || cacheCell != m_VoxelCacheCell)
+    {
+        RebuildVoxelCache(cacheCell, cacheCellSize);
+    }
+
+    if (m_VoxelLineCache.Num() == 0)
     {
         return;
     }
 
+    m_World->LineBatcher->DrawLines(m_VoxelLineCache);
+}
+
+void FProjectAcousticsDebugRender::RebuildVoxelCache(const FIntVector& cacheCell, float cacheCellSize)
+{
+    m_VoxelLineCache.Reset();
+    m_VoxelCacheCell = cacheCell;
+    // Mark valid even if extraction fails below, so we don't retry every frame.
+    // Loading new data invalidates the cache again.
+    m_IsVoxelCacheValid = true;
+
     auto tritonDebug = m_Acoustics->GetTritonDebugInstance();
     if (tritonDebug == nullptr)
     {
         return;
     }
 
-    // Convert to Triton coordinates
-    auto tritonPlayerPos = UnrealPositionToTriton(m_CameraPos);
-    auto tritonLookDir = UnrealDirectionToTriton(m_CameraLook);
-
-    // Select region of voxels near listener
     const auto voxelColor = FColor(0, 255, 0, 0);
-    // Slightly larger than half-FOV so edge of conical culling region
-    // doesn't become visible on screen corners
-    const auto frustumHalfAngleDegrees = 0.55f * m_CameraFOV;
-    // Range in cm we should see the voxels
-    const auto visibleDistance = m_VoxelVisibleDistance;
-    const auto regionMinOffset = UnrealPositionToTriton(FVector(visibleDistance, visibleDistance, visibleDistance / 2));
-    const auto regionMaxOffset = UnrealPositionToTriton(FVector(visibleDistance, visibleDistance, visibleDistance));
-
-    // Voxel box center is slightly lower so we're closer to the ground
-    auto regionCenter = tritonPlayerPos - UnrealPositionToTriton(FVector(0, 0, 50.0f));
-    auto minCornerIn = ToTritonVector(regionCenter - regionMinOffset);
-    auto maxCornerIn = ToTritonVector(regionCenter + regionMaxOffset);
+    // Same lifetime DrawDebugLine uses for non-persistent lines
+    const auto lifeTime = m_World->LineBatcher->DefaultLifeTime;
+    const auto cellCenter = (FVector(cacheCell) + FVector(0.5f)) * cacheCellSize;
+    // Range in cm we should see the voxels, from anywhere within the cache cell
+    const auto visibleDistance = m_VoxelVisibleDistance + 0.5f * cacheCellSize;
+
+    // Voxel box center is slightly lower so we're closer to the ground.
+    // Unreal to Triton flips Y, so take the component-wise min/max of the converted corners.
+    const auto regionCenter = cellCenter - FVector(0, 0, 50.0f);
+    const auto regionCorner0 =
+        UnrealPositionToTriton(regionCenter - FVector(visibleDistance, visibleDistance, visibleDistance / 2));
+    const auto regionCorner1 =
+        UnrealPositionToTriton(regionCenter + FVector(visibleDistance, visibleDistance, visibleDistance));
+    auto minCornerIn = ToTritonVector(regionCorner0.ComponentMin(regionCorner1));
+    auto maxCornerIn = ToTritonVector(regionCorner0.ComponentMax(regionCorner1));
     auto voxelSection = tritonDebug->GetVoxelmapSection(minCornerIn, maxCornerIn);
     if (voxelSection == nullptr)
     {
@@ -518,82 +586,51 @@ void FProjectAcousticsDebugRender::DrawVoxels()
     const auto incr = voxelSection->GetCellIncrementVector();
     auto cellIncrement = ToFVector(incr);
     auto halfCellIncrement = cellIncrement * 0.5f;
-
-    // We start from x=y=z=1, not 0, so the extra cellIncrement
-    auto startVoxelCenter = minCorner + cellIncrement + halfCellIncrement;
-    auto currentVoxelCenter = startVoxelCenter;
-    const auto cosHalfFrustumAngle = FMath::Cos(frustumHalfAngleDegrees * PI / 180.0f);
     const auto voxelSizeGame = TritonPositionToUnreal(cellIncrement).GetAbs();
     const auto numVoxels = voxelSection->GetNumCells();
 
-    for (auto x = 1; x < numVoxels.x - 1; x++, currentVoxelCenter.X += cellIncrement.X)
+    // Neighbor offsets and the face direction shared with each neighbor
+    static const FIntVector c_NeighborOffsets[] = {
+        FIntVector(-1, 0, 0), FIntVector(1, 0, 0), FIntVector(0, -1, 0),
+        FIntVector(0, 1, 0),  FIntVector(0, 0, -1), FIntVector(0, 0, 1)};
+    static const AAFaceDirection c_NeighborFaces[] = {
+        AAFaceDirection::X, AAFaceDirection::X, AAFaceDirection::Y,
+        AAFaceDirection::Y, AAFaceDirection::Z, AAFaceDirection::Z};
+
+    // We start from x=y=z=1, not 0, so every voxel visited has all six neighbors in the section.
+    // All surface faces are kept regardless of camera direction, since the cache outlives any particular view.
+    for (auto x = 1; x < numVoxels.x - 1; x++)
     {
-        for (auto y = 1; y < numVoxels.y - 1; y++, currentVoxelCenter.Y += cellIncrement.Y)
+        for (auto y = 1; y < numVoxels.y - 1; y++)
         {
-            for (auto z = 1; z < numVoxels.z - 1; z++, currentVoxelCenter.Z += cellIncrement.Z)
+            for (auto z = 1; z < numVoxels.z - 1; z++)
             {
-                // Poor Man's simple frustum culling with a conical frustum
-                auto cameraToVoxel = currentVoxelCenter - tritonPlayerPos;
-                cameraToVoxel.Normalize();
-                auto viewFrustumDotProd = FVector::DotProduct(cameraToVoxel, tritonLookDir);
-                if (viewFrustumDotProd > cosHalfFrustumAngle)
+                if (!voxelSection->IsVoxelWall(x, y, z))
                 {
-                    if (voxelSection->IsVoxelWall(x, y, z))
-                    {
-                        // Only consider the 3 faces visible to camera
-                        int dx = (cameraToVoxel.X * cellIncrement.X > 0) ? -1 : 1;
-                        int dy = (cameraToVoxel.Y * cellIncrement.Y > 0) ? -1 : 1;
-                        int dz = (cameraToVoxel.Z * cellIncrement.Z > 0) ? -1 : 1;
-
-                        // For the three front faces, only render if the face is on the
-                        // surface -- that is, the voxel across it is air.
-
-                        // front-face in X
-                        if (!voxelSection->IsVoxelWall(x + dx, y, z))
-                        {
-                            auto faceCenter = currentVoxelCenter;
-                            faceCenter.X += halfCellIncrement.X * dx;
-
-                            DrawDebugAARectangle(
-                                m_World,
-                                TritonPositionToUnreal(faceCenter),
-                                voxelSizeGame,
-                                AAFaceDirection::X,
-                                voxelColor);
-                        }
-
-                        // front-face in Y
-                        if (!voxelSection->IsVoxelWall(x, y + dy, z))
-                        {
-                            auto faceCenter = currentVoxelCenter;
-                            faceCenter.Y += halfCellIncrement.Y * dy;
-                            DrawDebugAARectangle(
-                                m_World,
-                                TritonPositionToUnreal(faceCenter),
-                                voxelSizeGame,
-                                AAFaceDirection::Y,
-                                voxelColor);
-                        }
+                    continue;
+                }
 
-                        // front-face in Z
-                        if (!voxelSection->IsVoxelWall(x, y, z + dz))
-                        {
-                            auto faceCenter = currentVoxelCenter;
-                            faceCenter.Z += halfCellIncrement.Z * dz;
-                            DrawDebugAARectangle(
-                                m_World,
-                                TritonPositionToUnreal(faceCenter),
-                                voxelSizeGame,
-                                AAFaceDirection::Z,
-                                voxelColor);
-                        }
+                const auto voxelCenter = minCorner + cellIncrement * FVector(x, y, z) + halfCellIncrement;
+                for (int n = 0; n < UE_ARRAY_COUNT(c_NeighborOffsets); n++)
+                {
+                    const auto& d = c_NeighborOffsets[n];
+                    // Only faces on the surface -- that is, the voxel across it is air.
+                    if (voxelSection->IsVoxelWall(x + d.X, y + d.Y, z + d.Z))
+                    {
+                        continue;
                     }
+
+                    const auto faceCenter = voxelCenter + halfCellIncrement * FVector(d);
+                    AddAARectangleLines(
+                        m_VoxelLineCache,
+                        TritonPositionToUnreal(faceCenter),
+                        voxelSizeGame,
+                        c_NeighborFaces[n],
+                        voxelColor,
+                        lifeTime);
                 }
             }
-            currentVoxelCenter.Z = startVoxelCenter.Z;
         }
-        currentVoxelCenter.Y = startVoxelCenter.Y;
-        currentVoxelCenter.Z = startVoxelCenter.Z;
     }
 
     VoxelmapSection::Destroy(voxelSection);
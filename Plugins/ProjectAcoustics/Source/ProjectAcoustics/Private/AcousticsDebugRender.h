@@ -5,6 +5,9 @@
 #include "CoreMinimal.h"
 #include "TritonWwiseParams.h"
 #include "QueryDebugInfo.h"
+#if !UE_BUILD_SHIPPING
+#include "Components/LineBatchComponent.h"
+#endif
 
 enum class AAFaceDirection
 {
@@ -53,9 +56,17 @@ private:
     void DrawProbes();
     void DrawDistances();
     void DrawSources();
+    void RebuildVoxelCache(const FIntVector& cacheCell, float cacheCellSize);
+
+    // Voxel surface faces around the camera. Extracted once per cache cell and
+    // submitted to the world's line batcher as a single batch every frame.
+    TArray<FBatchedLine> m_VoxelLineCache;
+    FIntVector m_VoxelCacheCell = FIntVector::ZeroValue;
 #endif
     // Exposed voxel distance
     float m_VoxelVisibleDistance = 1000.f;
+    // Cleared when the loaded data or the visible distance changes
+    bool m_IsVoxelCacheValid = false;
 
     FVector m_ConfidentDirection = FVector::ZeroVector;
     float m_Confidence = 0;
@@ -78,10 +89,18 @@ public:
     static void DrawDebugAARectangle(
         const UWorld* inWorld, const FVector& faceCenter, const FVector& faceSize, AAFaceDirection dir,
         const FColor& color);
+    // Same as DrawDebugAARectangle, but appends the four edges to a line batch instead of drawing them.
+    static void AddAARectangleLines(
+        TArray<FBatchedLine>& outLines, const FVector& faceCenter, const FVector& faceSize, AAFaceDirection dir,
+        const FColor& color, float lifeTime);
 #endif
 
     void SetVoxelVisibleDistance(const float InVisibleDistance)
     {
-        m_VoxelVisibleDistance = InVisibleDistance;
+        if (m_VoxelVisibleDistance != InVisibleDistance)
+        {
+            m_VoxelVisibleDistance = InVisibleDistance;
+            m_IsVoxelCacheValid = false;
+        }
     }
 };
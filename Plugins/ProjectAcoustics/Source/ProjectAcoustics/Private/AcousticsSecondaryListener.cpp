@@ -56,6 +56,9 @@ void UAcousticsSecondaryListener::BeginPlay()
         m_Acoustics = &(IAcoustics::Get());
     }
 
+    // Only hear sounds made after spawning
+    m_StimulusCursor = FAcousticsStimulusBus::Get().GetCursor();
+
     // Initialize directional reflection indices.
     for (size_t i = 0; i < 4; ++i)
     {
@@ -220,6 +223,7 @@ void UAcousticsSecondaryListener::ResetPolicy()
     m_AllAmbientParams.Empty();
     
     m_AllTargetEnergies.Empty();
+    m_AllTargetActors.Empty();
     m_AllAmbientEnergies.Empty();
     
     m_reverbNoiseEnergy.fill(1);
@@ -429,6 +433,7 @@ void UAcousticsSecondaryListener::AccumulateTargets()
                 AddEnergy(s);
             }
             m_AllTargetEnergies.Add(s);
+            m_AllTargetActors.Add(a);
 
             tritonParams.DirectLoudnessDB += extraLoudnessDb;
         }
@@ -549,12 +554,55 @@ void UAcousticsSecondaryListener::AccumulateAmbiences()
     }
 }
 
+void UAcousticsSecondaryListener::AccumulateStimuli()
+{
+    // Pick up everything posted since the last update in one go
+    FAcousticsStimulusBus::Get().Consume(m_StimulusCursor, m_RecentStimuli);
+
+    const auto world = GetWorld();
+    const auto owner = GetOwner();
+    const auto now = world->GetTimeSeconds();
+    m_RecentStimuli.RemoveAll([&](const FAcousticsStimulus& stimulus) {
+        return now - stimulus.Time > StimulusMemorySeconds || stimulus.World.Get() != world ||
+               stimulus.Instigator.Get() == owner;
+    });
+
+    const auto listenerLoc = owner->GetActorLocation();
+    const int firstStimulusId = TargetObjects.Num() + Ambiences.Num();
+    for (int i = 0; i < m_RecentStimuli.Num(); i++)
+    {
+        const auto& stimulus = m_RecentStimuli[i];
+
+        TritonAcousticParameters tritonParams;
+#if !UE_BUILD_SHIPPING
+        INC_DWORD_STAT_BY(STAT_Acoustics_NpcQuery, 1);
+#endif
+        if (!m_Acoustics->QueryAcoustics(firstStimulusId + i, stimulus.Location, listenerLoc, tritonParams))
+        {
+            continue;
+        }
+
+        SourceEnergy s = TritonParamsToSourceEnergy(tritonParams, stimulus.LoudnessDb);
+        if (!IgnoreAmbiences)
+        {
+            AddEnergyToNoiseFloor(s);
+            AddEnergy(s);
+        }
+        m_AllTargetEnergies.Add(s);
+        m_AllTargetActors.Add(stimulus.Instigator);
+    }
+}
+
 void UAcousticsSecondaryListener::AccumulatePolicyInputs()
 {
 #if !UE_BUILD_SHIPPING
     SCOPE_CYCLE_COUNTER(STAT_Acoustics_NpcPolicyInput);
 #endif
     AccumulateTargets();
+    if (ListenToStimuli)
+    {
+        AccumulateStimuli();
+    }
     if (ConsiderAmbiences)
     {
         AccumulateAmbiences();
@@ -647,9 +695,10 @@ void UAcousticsSecondaryListener::ShowDebugInfo()
 
 AActor* UAcousticsSecondaryListener::GetLoudestActor()
 {
-    if (m_LoudestTargetIndex >= 0)
+    // Index is into m_AllTargetEnergies, which also holds stimuli and skips silent targets
+    if (m_AllTargetActors.IsValidIndex(m_LoudestTargetIndex))
     {
-        return TargetObjects[m_LoudestTargetIndex];
+        return m_AllTargetActors[m_LoudestTargetIndex].Get();
     }
     return nullptr;
 }
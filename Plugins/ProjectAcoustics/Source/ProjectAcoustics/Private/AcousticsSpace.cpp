@@ -23,6 +23,22 @@ static TAutoConsoleVariable<int32>
 static TAutoConsoleVariable<int32>
     CVarAcousticsShowStats(TEXT("PA.ShowStats"), 0, TEXT("Show Project Acoustics statistics?"));
 
+// Budget mode tuning.
+// Seconds between tile size adjustments
+constexpr float c_BudgetUpdateInterval = 1.0f;
+// Memory use the tile size is steered towards, as a fraction of budget
+constexpr float c_BudgetTargetFraction = 0.85f;
+// Grow the tile only when memory use drops below this fraction of budget
+constexpr float c_BudgetGrowThreshold = 0.7f;
+// Largest share of the budget the fixed cost of the ACE file (mostly the query cache) may take
+constexpr float c_BudgetCacheFraction = 0.25f;
+// Limits on a single adjustment, to avoid oscillating between load and unload
+constexpr float c_BudgetMinStepScale = 0.5f;
+constexpr float c_BudgetMaxStepScale = 1.5f;
+// Limits on the horizontal tile size, in cm and as a multiple of TileSize
+constexpr float c_BudgetMinTileSize = 1000.0f;
+constexpr float c_BudgetMaxTileScale = 4.0f;
+
 AAcousticsSpace::AAcousticsSpace(const class FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
     PrimaryActorTick.bCanEverTick = true;
@@ -39,10 +55,15 @@ AAcousticsSpace::AAcousticsSpace(const class FObjectInitializer& ObjectInitializ
     // Main parameters
     TileSize = FVector(5000, 5000, 5000);
     AutoStream = true;
+    LoadAsync = true;
     UpdateDistances = false;
     CacheScale = 1.0f;
+    MemoryBudgetMB = 0.0f;
 
     m_Acoustics = nullptr;
+    m_BudgetTileSize = TileSize;
+    m_BudgetBaselineMemory = 0;
+    m_LastBudgetUpdateTime = 0.0f;
 
     // Design controls
     auto d = UserDesign::Default();
@@ -69,19 +90,22 @@ void AAcousticsSpace::BeginPlay()
     {
         // cache module instance
         m_Acoustics = &(IAcoustics::Get());
+        // Must be in place before loading, the cache scale depends on it
+        m_Acoustics->SetMemoryBudgetOverride(MemoryBudgetMB);
 
 #if !UE_BUILD_SHIPPING
         // Update with current enabled state
         m_Acoustics->SetEnabled(AcousticsEnabled);
 #endif
 
-        auto success = LoadAcousticsData(AcousticsData);
-
-        if (success && AutoStream)
+        // The first tile is streamed in once loading completes
+        if (LoadAsync)
         {
-            // Stream in the first tile if AutoLoad is enabled
-            auto listenerPosition = GetListenerPosition();
-            m_Acoustics->UpdateLoadedRegion(listenerPosition, TileSize, true, true, true);
+            LoadAcousticsDataAsync(AcousticsData);
+        }
+        else
+        {
+            LoadAcousticsData(AcousticsData);
         }
     }
 
@@ -138,6 +162,9 @@ void AAcousticsSpace::Tick(float deltaSeconds)
         m_Acoustics->SetGlobalDesign(globalParams);
     }
 
+    // Picks up changes made from blueprints
+    m_Acoustics->SetMemoryBudgetOverride(MemoryBudgetMB);
+
     // Update things dependent only on listener
     if (GetWorld()->IsGameWorld())
     {
@@ -146,8 +173,10 @@ void AAcousticsSpace::Tick(float deltaSeconds)
         // Update streaming
         if (AutoStream)
         {
+            // A new tile size needs a fresh load even if the player hasn't moved
+            const bool tileSizeChanged = UpdateBudgetTileSize();
             // TODO: MICHEM: Changed to blocking load to try to prevent heap issues
-            m_Acoustics->UpdateLoadedRegion(listenerPosition, TileSize, false, true, true);
+            m_Acoustics->UpdateLoadedRegion(listenerPosition, GetStreamingTileSize(), tileSizeChanged, true, true);
         }
 
         // If there are active emitters in the scene, they will
@@ -192,6 +221,7 @@ void AAcousticsSpace::BeginDestroy()
     if (m_Acoustics)
     {
         m_Acoustics->UnloadAceFile();
+        m_Acoustics->SetMemoryBudgetOverride(0);
     }
 }
 
@@ -202,7 +232,7 @@ void AAcousticsSpace::ForceLoadTile(FVector centerPosition, bool unloadProbesOut
         return;
     }
 
-    m_Acoustics->UpdateLoadedRegion(centerPosition, TileSize, true, unloadProbesOutsideTile, true);
+    m_Acoustics->UpdateLoadedRegion(centerPosition, GetStreamingTileSize(), true, unloadProbesOutsideTile, true);
 }
 
 bool AAcousticsSpace::LoadAcousticsData(UAcousticsData* newData)
@@ -220,6 +250,32 @@ bool AAcousticsSpace::LoadAcousticsData(UAcousticsData* newData)
     return LoadAceFile(filePath);
 }
 
+bool AAcousticsSpace::LoadAcousticsDataAsync(UAcousticsData* newData)
+{
+    AcousticsData = newData;
+    if (newData == nullptr)
+    {
+        if (m_Acoustics)
+        {
+            m_Acoustics->UnloadAceFile();
+        }
+        return true;
+    }
+    auto filePath = newData->AceFilePath;
+    return LoadAceFileAsync(filePath);
+}
+
+bool AAcousticsSpace::IsAcousticsDataReady() const
+{
+    if (!m_Acoustics || m_Acoustics->IsAceFileLoadPending())
+    {
+        return false;
+    }
+
+    TritonRuntime::TritonStats stats;
+    return m_Acoustics->GetPerfStats(stats);
+}
+
 bool AAcousticsSpace::LoadAceFile(FString filePath)
 {
     if (!m_Acoustics)
@@ -227,22 +283,115 @@ bool AAcousticsSpace::LoadAceFile(FString filePath)
         return false;
     }
 
+    m_BudgetTileSize = TileSize;
+    m_BudgetBaselineMemory = 0;
     auto success = m_Acoustics->LoadAceFile(filePath, CacheScale);
     if (success)
     {
+        const auto budgetCacheScale = GetBudgetCacheScale();
+        if (budgetCacheScale > 0)
+        {
+            success = m_Acoustics->LoadAceFile(filePath, budgetCacheScale);
+        }
+    }
+
+    return FinishAceFileLoad(filePath, success);
+}
+
+bool AAcousticsSpace::LoadAceFileAsync(FString filePath)
+{
+    if (!m_Acoustics)
+    {
+        return false;
+    }
+
+    m_BudgetTileSize = TileSize;
+    m_BudgetBaselineMemory = 0;
+    auto onComplete = FAcousticsAceLoadComplete::CreateUObject(this, &AAcousticsSpace::HandleAceFileLoaded, filePath, true);
+    if (!m_Acoustics->LoadAceFileAsync(filePath, CacheScale, onComplete))
+    {
+        return FinishAceFileLoad(filePath, false);
+    }
+
+    return true;
+}
+
+void AAcousticsSpace::HandleAceFileLoaded(bool success, FString filePath, bool allowBudgetReload)
+{
+    if (success && allowBudgetReload)
+    {
+        // Only reload once, the measured baseline already accounts for the smaller cache
+        const auto budgetCacheScale = GetBudgetCacheScale();
+        if (budgetCacheScale > 0)
+        {
+            auto onComplete =
+                FAcousticsAceLoadComplete::CreateUObject(this, &AAcousticsSpace::HandleAceFileLoaded, filePath, false);
+            if (m_Acoustics->LoadAceFileAsync(filePath, budgetCacheScale, onComplete))
+            {
+                return;
+            }
+            success = false;
+        }
+    }
+
+    FinishAceFileLoad(filePath, success);
+}
+
+float AAcousticsSpace::GetMemoryBudgetMB() const
+{
+    return m_Acoustics ? m_Acoustics->GetMemoryBudgetMB() : 0;
+}
+
+float AAcousticsSpace::GetBudgetCacheScale()
+{
+    const float budgetMB = GetMemoryBudgetMB();
+    if (budgetMB <= 0)
+    {
+        return 0;
+    }
+
+    // Nothing is streamed in yet, so this is the fixed cost of the file, mostly the query cache.
+    // If it takes too much of the budget, the cache needs to shrink.
+    const double budget = budgetMB * 1024.0 * 1024.0;
+    const double cacheBudget = c_BudgetCacheFraction * budget;
+    m_BudgetBaselineMemory = m_Acoustics->GetMemoryUsed();
+    if (m_BudgetBaselineMemory <= cacheBudget || CacheScale <= 0)
+    {
+        return 0;
+    }
+
+    const float budgetCacheScale = CacheScale * static_cast<float>(cacheBudget / m_BudgetBaselineMemory);
+    UE_LOG(
+        LogAcousticsRuntime,
+        Log,
+        TEXT("ACE file uses [%lld]MB before streaming, reloading with cache scale [%.2f] to fit budget"),
+        m_BudgetBaselineMemory >> 20,
+        budgetCacheScale);
+    return budgetCacheScale;
+}
+
+bool AAcousticsSpace::FinishAceFileLoad(const FString& filePath, bool success)
+{
+    if (success)
+    {
+        if (GetMemoryBudgetMB() > 0)
+        {
+            m_BudgetBaselineMemory = m_Acoustics->GetMemoryUsed();
+        }
+
         if (AutoStream)
         {
             auto listenerPosition = GetListenerPosition();
-            m_Acoustics->UpdateLoadedRegion(listenerPosition, TileSize, true, true, true);
+            m_Acoustics->UpdateLoadedRegion(listenerPosition, GetStreamingTileSize(), true, true, true);
         }
     }
     else
     {
         UE_LOG(LogAcousticsRuntime, Error, TEXT("Failed to load ACE file [%s]"), *filePath);
-        return false;
     }
 
-    return true;
+    OnAcousticsDataLoaded.Broadcast(success);
+    return success;
 }
 
 bool AAcousticsSpace::QueryDistance(const FVector lookDirection, float& distance)
@@ -279,6 +428,79 @@ void AAcousticsSpace::SetAcousticsEnabled(bool isEnabled)
     }
 }
 
+FVector AAcousticsSpace::GetStreamingTileSize() const
+{
+    return GetMemoryBudgetMB() > 0 ? m_BudgetTileSize : TileSize;
+}
+
+bool AAcousticsSpace::UpdateBudgetTileSize()
+{
+    const float budgetMB = GetMemoryBudgetMB();
+    if (budgetMB <= 0)
+    {
+        return false;
+    }
+
+    const auto now = GetWorld()->GetRealTimeSeconds();
+    if (now - m_LastBudgetUpdateTime < c_BudgetUpdateInterval)
+    {
+        return false;
+    }
+
+    // Only measure once streaming has settled, otherwise probe counts and memory disagree
+    TritonRuntime::TritonStats stats;
+    if (!m_Acoustics->GetPerfStats(stats) || stats.ProbesInRAM <= 0 || stats.ProbesPendingLoad > 0 ||
+        stats.ProbesPendingUnload > 0)
+    {
+        return false;
+    }
+    m_LastBudgetUpdateTime = now;
+
+    const double used = m_Acoustics->GetMemoryUsed();
+    if (used <= 0)
+    {
+        return false;
+    }
+
+    const double budget = budgetMB * 1024.0 * 1024.0;
+    if (used <= budget && used >= c_BudgetGrowThreshold * budget)
+    {
+        return false;
+    }
+
+    // Probes are placed over walkable area, so the number loaded scales with the tile's horizontal area.
+    // Work out how many probes fit the target, then the area that holds them at the observed density.
+    const double fixedCost = FMath::Min<double>(m_BudgetBaselineMemory, used);
+    const double bytesPerProbe = FMath::Max(1.0, (used - fixedCost) / stats.ProbesInRAM);
+    const double targetProbes = FMath::Max(1.0, (c_BudgetTargetFraction * budget - fixedCost) / bytesPerProbe);
+    const double tileArea = FMath::Max(1.0, static_cast<double>(m_BudgetTileSize.X) * m_BudgetTileSize.Y);
+    const double probeDensity = stats.ProbesInRAM / tileArea;
+    const double targetArea = targetProbes / probeDensity;
+
+    const float stepScale = FMath::Clamp(
+        static_cast<float>(FMath::Sqrt(targetArea / tileArea)), c_BudgetMinStepScale, c_BudgetMaxStepScale);
+    auto newTileSize = m_BudgetTileSize;
+    newTileSize.X = FMath::Clamp(
+        newTileSize.X * stepScale, c_BudgetMinTileSize, FMath::Max(c_BudgetMinTileSize, TileSize.X * c_BudgetMaxTileScale));
+    newTileSize.Y = FMath::Clamp(
+        newTileSize.Y * stepScale, c_BudgetMinTileSize, FMath::Max(c_BudgetMinTileSize, TileSize.Y * c_BudgetMaxTileScale));
+    if (newTileSize.Equals(m_BudgetTileSize, 1.0f))
+    {
+        return false;
+    }
+
+    UE_LOG(
+        LogAcousticsRuntime,
+        Verbose,
+        TEXT("Acoustics memory [%d]MB of [%d]MB budget, resizing streaming tile to [%.0f x %.0f]"),
+        static_cast<int>(used / (1024.0 * 1024.0)),
+        static_cast<int>(budgetMB),
+        newTileSize.X,
+        newTileSize.Y);
+    m_BudgetTileSize = newTileSize;
+    return true;
+}
+
 #if WITH_EDITOR
 // React to changes in properties that are not handled in Tick()
 void AAcousticsSpace::PostEditChangeProperty(struct FPropertyChangedEvent& e)
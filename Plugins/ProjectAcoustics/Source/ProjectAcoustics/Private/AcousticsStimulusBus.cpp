@@ -0,0 +1,100 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "AcousticsStimulusBus.h"
+#include "GameFramework/Actor.h"
+#include "Engine/World.h"
+
+DEFINE_STAT(STAT_Acoustics_StimuliPosted);
+DEFINE_STAT(STAT_Acoustics_StimuliConsumed);
+DEFINE_STAT(STAT_Acoustics_StimuliDropped);
+
+static_assert(
+    (FAcousticsStimulusBus::Capacity & (FAcousticsStimulusBus::Capacity - 1)) == 0,
+    "Stimulus bus capacity must be a power of two");
+
+FAcousticsStimulusBus& FAcousticsStimulusBus::Get()
+{
+    static FAcousticsStimulusBus s_Bus;
+    return s_Bus;
+}
+
+FAcousticsStimulusBus::FAcousticsStimulusBus() : m_NextSequence(0)
+{
+    for (auto& slot : m_Slots)
+    {
+        slot.Tag = 0;
+    }
+}
+
+void FAcousticsStimulusBus::Post(const FAcousticsStimulus& stimulus)
+{
+    // Claim a sequence number, then write the slot seqlock-style so readers can tell
+    // a half-written or overwritten slot from a finished one.
+    const int64 sequence = FPlatformAtomics::InterlockedIncrement(&m_NextSequence) - 1;
+    auto& slot = m_Slots[sequence & (Capacity - 1)];
+    FPlatformAtomics::InterlockedExchange(&slot.Tag, 0);
+    slot.Stimulus = stimulus;
+    FPlatformAtomics::InterlockedExchange(&slot.Tag, sequence + 1);
+
+    INC_DWORD_STAT(STAT_Acoustics_StimuliPosted);
+}
+
+void FAcousticsStimulusBus::Post(const FVector& location, float loudnessDb, AActor* instigator)
+{
+    FAcousticsStimulus stimulus;
+    stimulus.Location = location;
+    stimulus.LoudnessDb = loudnessDb;
+    stimulus.Instigator = instigator;
+    stimulus.World = instigator ? instigator->GetWorld() : nullptr;
+    stimulus.Time = stimulus.World.IsValid() ? stimulus.World->GetTimeSeconds() : 0.0f;
+    Post(stimulus);
+}
+
+uint64 FAcousticsStimulusBus::GetCursor() const
+{
+    return FPlatformAtomics::AtomicRead(&m_NextSequence);
+}
+
+int32 FAcousticsStimulusBus::Consume(uint64& cursor, TArray<FAcousticsStimulus>& outStimuli) const
+{
+    const int64 end = FPlatformAtomics::AtomicRead(&m_NextSequence);
+    // Anything older than a full buffer has been overwritten already
+    int64 sequence = FMath::Max<int64>(cursor, end - Capacity);
+    int32 numDropped = static_cast<int32>(sequence - cursor);
+    int32 numConsumed = 0;
+
+    for (; sequence < end; sequence++)
+    {
+        const auto& slot = m_Slots[sequence & (Capacity - 1)];
+        const int64 tag = FPlatformAtomics::AtomicRead(&slot.Tag);
+        if (tag > sequence + 1)
+        {
+            // Lapped by writers
+            numDropped++;
+            continue;
+        }
+        if (tag != sequence + 1)
+        {
+            // Still being written, pick it up next time
+            break;
+        }
+
+        const FAcousticsStimulus stimulus = slot.Stimulus;
+        FPlatformMisc::MemoryBarrier();
+        if (FPlatformAtomics::AtomicRead(&slot.Tag) != tag)
+        {
+            // Overwritten while copying
+            numDropped++;
+            continue;
+        }
+
+        outStimuli.Add(stimulus);
+        numConsumed++;
+    }
+    cursor = sequence;
+
+    INC_DWORD_STAT_BY(STAT_Acoustics_StimuliConsumed, numConsumed);
+    INC_DWORD_STAT_BY(STAT_Acoustics_StimuliDropped, numDropped);
+    return numDropped;
+}
@@ -6,6 +6,8 @@
 #include "IAcoustics.h"
 #include "AcousticsDebugRender.h"
 #include "MathUtils.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Async/Async.h"
 
 using namespace TritonRuntime;
 
@@ -18,6 +20,19 @@ DEFINE_STAT(STAT_Acoustics_QueryOutdoorness);
 DEFINE_STAT(STAT_Acoustics_LoadRegion);
 DEFINE_STAT(STAT_Acoustics_LoadAce);
 DEFINE_STAT(STAT_Acoustics_ClearAce);
+DEFINE_STAT(STAT_Acoustics_ProbesInRAM);
+DEFINE_STAT(STAT_Acoustics_ProbesPendingLoad);
+DEFINE_STAT(STAT_Acoustics_ProbesPendingUnload);
+DEFINE_STAT(STAT_Acoustics_ProbesLoadFailed);
+DEFINE_STAT(STAT_Acoustics_NumQueries);
+DEFINE_STAT(STAT_Acoustics_NumFailed);
+DEFINE_STAT(STAT_Acoustics_NumStreamingFailed);
+DEFINE_STAT(STAT_Acoustics_AvgQueryTime);
+DEFINE_STAT(STAT_Acoustics_MaxQueryTime);
+DEFINE_STAT(STAT_Acoustics_CacheQueries);
+DEFINE_STAT(STAT_Acoustics_CacheHits);
+
+CSV_DEFINE_CATEGORY(Acoustics, true);
 
 // Speed of sound in cm/sec
 constexpr int c_SpeedOfSoundCm = 34000;
@@ -36,6 +51,44 @@ static FAutoConsoleVariableRef CVarAcousticsAceTileLoadMargin(
                 TEXT("0 is extremely safe but lots of I/O, 1 is no safety.\n"),
     ECVF_Default);
 
+// Route Triton allocations through the size-class pool instead of straight to FMemory.
+// Read once at module startup, so set it in the [ConsoleVariables] section of DefaultEngine.ini.
+int32 c_UsePooledAllocator = 0;
+static FAutoConsoleVariableRef CVarAcousticsUsePooledAllocator(
+    TEXT("PA.UsePooledAllocator"), c_UsePooledAllocator,
+    TEXT("Route Project Acoustics allocations through a size-class pool.\n")
+        TEXT("Only read at startup.\n"),
+    ECVF_ReadOnly);
+
+// Hard memory budget for acoustic data. ACE streaming won't load more probes while over it.
+int32 c_MemoryBudgetMB = 0;
+static FAutoConsoleVariableRef CVarAcousticsMemoryBudgetMB(
+    TEXT("PA.MemoryBudgetMB"), c_MemoryBudgetMB,
+    TEXT("Memory budget for Project Acoustics in MB. 0 means no limit.\n")
+        TEXT("Probe streaming is paused while memory used is over budget.\n")
+        TEXT("MemoryBudgetMB on the acoustics space overrides this when set.\n"),
+    ECVF_Default);
+
+// Interval in seconds between Triton stats lines written to the log.
+// Lets headless servers without a debug overlay keep track of acoustics cost.
+float c_StatsLogInterval = 60.0f;
+static FAutoConsoleVariableRef CVarAcousticsStatsLogInterval(
+    TEXT("PA.StatsLogInterval"), c_StatsLogInterval,
+    TEXT("Interval in seconds between Project Acoustics stats lines written to the log.\n")
+        TEXT("0 disables periodic logging.\n"),
+    ECVF_Default);
+
+static FAutoConsoleCommand CmdAcousticsDumpStats(
+    TEXT("PA.DumpStats"), TEXT("Write Project Acoustics stats to the log, then reset them."),
+    FConsoleCommandDelegate::CreateLambda([]() {
+        if (IAcoustics::IsAvailable())
+        {
+            auto& acoustics = static_cast<FProjectAcousticsModule&>(IAcoustics::Get());
+            acoustics.LogPerfStats();
+            acoustics.ResetPerfStats();
+        }
+    }));
+
 // Computed outdoorness is 0 only if player is completely enclosed
 // and 1 only when player is standing on a flat plane with no other geometry.
 // These constants bring the range closer to practically observed values.
@@ -59,6 +112,9 @@ FProjectAcousticsModule::FProjectAcousticsModule()
     , m_IsOutdoornessStale(true)
     , m_CachedOutdoorness(0)
     , m_GlobalDesign(UserDesign::Default())
+    , m_LastStatsLogTime(0)
+    , m_IsStreamingPausedForBudget(false)
+    , m_MemoryBudgetOverrideMB(0)
 {
 #if !UE_BUILD_SHIPPING
     m_IsEnabled = true;
@@ -67,7 +123,7 @@ FProjectAcousticsModule::FProjectAcousticsModule()
 
 void FProjectAcousticsModule::StartupModule()
 {
-    m_TritonMemHook = TUniquePtr<FTritonMemHook>(new FTritonMemHook());
+    m_TritonMemHook = TUniquePtr<FTritonMemHook>(new FTritonMemHook(c_UsePooledAllocator != 0));
     m_TritonLogHook = TUniquePtr<FTritonLogHook>(new FTritonLogHook());
     auto initSuccess = TritonAcoustics::Init(m_TritonMemHook.Get(), m_TritonLogHook.Get());
     if (!initSuccess)
@@ -96,6 +152,7 @@ void FProjectAcousticsModule::ShutdownModule()
     // we call this function before unloading the module.
     if (m_Triton)
     {
+        WaitForPendingAceLoad();
         TritonAcoustics::DestroyInstance(m_Triton);
         TritonAcoustics::TearDown();
         m_Triton = nullptr;
@@ -136,21 +193,18 @@ bool FProjectAcousticsModule::LoadAceFile(const FString& filePath, const float c
     }
 
     UnloadAceFile();
+    // Before loading, so that the ACE file's fixed cost is counted against the budget
+    ApplyMemoryBudget();
 
     auto fullFilePath = FPaths::ProjectDir() + filePath;
     {
         SCOPE_CYCLE_COUNTER(STAT_Acoustics_LoadAce);
         // Load the ACE file
-        m_TritonIOHook = TUniquePtr<FTritonUnrealIOHook>(new FTritonUnrealIOHook());
-        if (!m_TritonIOHook->OpenForRead(TCHAR_TO_ANSI(*fullFilePath)))
+        if (!OpenAceFile(fullFilePath))
         {
-            m_TritonIOHook.Reset();
-
-            UE_LOG(LogAcousticsRuntime, Error, TEXT("Failed to open ACE file for reading: [%s]"), *fullFilePath);
             return false;
         }
 
-        m_TritonTaskHook = TUniquePtr<FTritonAsyncTaskHook>(new FTritonAsyncTaskHook());
         if (!m_Triton->InitLoad(m_TritonIOHook.Get(), m_TritonTaskHook.Get(), cacheScale))
         {
             UE_LOG(LogAcousticsRuntime, Error, TEXT("Failed to load ACE file: [%s]"), *fullFilePath);
@@ -158,13 +212,111 @@ bool FProjectAcousticsModule::LoadAceFile(const FString& filePath, const float c
         }
     }
 
+    OnAceFileLoaded(filePath);
+    return true;
+}
+
+bool FProjectAcousticsModule::LoadAceFileAsync(
+    const FString& filePath, const float cacheScale, FAcousticsAceLoadComplete onComplete)
+{
+    if (!m_Triton)
+    {
+        return false;
+    }
+
+    UnloadAceFile();
+    ApplyMemoryBudget();
+
+    // Opening the file is cheap, so do it here and report a missing file straight away
+    auto fullFilePath = FPaths::ProjectDir() + filePath;
+    if (!OpenAceFile(fullFilePath))
+    {
+        return false;
+    }
+
+    m_PendingAceFilePath = filePath;
+    m_OnAceLoadComplete = MoveTemp(onComplete);
+
+    auto triton = m_Triton;
+    auto ioHook = m_TritonIOHook.Get();
+    auto taskHook = m_TritonTaskHook.Get();
+    m_PendingAceLoad = Async(EAsyncExecution::ThreadPool, [triton, ioHook, taskHook, cacheScale, fullFilePath]() {
+        SCOPE_CYCLE_COUNTER(STAT_Acoustics_LoadAce);
+        if (!triton->InitLoad(ioHook, taskHook, cacheScale))
+        {
+            UE_LOG(LogAcousticsRuntime, Error, TEXT("Failed to load ACE file: [%s]"), *fullFilePath);
+            return false;
+        }
+        return true;
+    });
+
+    return true;
+}
+
+bool FProjectAcousticsModule::OpenAceFile(const FString& fullFilePath)
+{
+    m_TritonIOHook = TUniquePtr<FTritonUnrealIOHook>(new FTritonUnrealIOHook());
+    if (!m_TritonIOHook->OpenForRead(TCHAR_TO_ANSI(*fullFilePath)))
+    {
+        m_TritonIOHook.Reset();
+
+        UE_LOG(LogAcousticsRuntime, Error, TEXT("Failed to open ACE file for reading: [%s]"), *fullFilePath);
+        return false;
+    }
+
+    m_TritonTaskHook = TUniquePtr<FTritonAsyncTaskHook>(new FTritonAsyncTaskHook());
+    return true;
+}
+
+void FProjectAcousticsModule::OnAceFileLoaded(const FString& filePath)
+{
     m_AceFileLoaded = true;
+    // Stats can only be collected after InitLoad()
+    m_Triton->StartCollectingStats();
+    m_LastStatsLogTime = FPlatformTime::Seconds();
 
 #if !UE_BUILD_SHIPPING
     m_DebugRenderer->SetLoadedFilename(filePath);
 #endif
+}
 
-    return true;
+// Called on the game thread. Finishes an asynchronous load once the worker is done with Triton.
+void FProjectAcousticsModule::CompletePendingAceLoad()
+{
+    if (!m_PendingAceLoad.IsValid() || !m_PendingAceLoad.IsReady())
+    {
+        return;
+    }
+
+    const auto success = m_PendingAceLoad.Get();
+    m_PendingAceLoad = TFuture<bool>();
+    if (success)
+    {
+        OnAceFileLoaded(m_PendingAceFilePath);
+    }
+    else
+    {
+        m_TritonIOHook.Reset();
+    }
+
+    // Move out first, the delegate may start another load
+    auto onComplete = MoveTemp(m_OnAceLoadComplete);
+    m_OnAceLoadComplete.Unbind();
+    onComplete.ExecuteIfBound(success);
+}
+
+void FProjectAcousticsModule::WaitForPendingAceLoad()
+{
+    if (!m_PendingAceLoad.IsValid())
+    {
+        return;
+    }
+
+    // InitLoad() has to finish before Triton can be cleared or destroyed
+    m_PendingAceLoad.Wait();
+    m_AceFileLoaded = m_PendingAceLoad.Get();
+    m_PendingAceLoad = TFuture<bool>();
+    m_OnAceLoadComplete.Unbind();
 }
 
 void FProjectAcousticsModule::UnloadAceFile()
@@ -174,6 +326,8 @@ void FProjectAcousticsModule::UnloadAceFile()
         return;
     }
 
+    WaitForPendingAceLoad();
+
     if (m_AceFileLoaded)
     {
         SCOPE_CYCLE_COUNTER(STAT_Acoustics_ClearAce);
@@ -182,9 +336,9 @@ void FProjectAcousticsModule::UnloadAceFile()
     }
 
     m_TritonIOHook.Reset();
+    m_TritonMemHook->TrimPool();
 }
 
-#if !UE_BUILD_SHIPPING
 static void UnrealCartesianToTritonSpherical(const FVector& arrivalDir, float& azimuth, float& elevation)
 {
     auto v = UnrealDirectionToTriton(arrivalDir);
@@ -224,13 +378,12 @@ static TritonAcousticParameters MakeFreefieldParameters(const FVector& sourceLoc
                                     zeroDecayTime,
                                     zeroDecayTime};
 }
-#endif
 
 bool FProjectAcousticsModule::AddDynamicOpening(
     class UAcousticsDynamicOpening* opening, const FVector& center, const FVector& normal,
     const TArray<FVector>& verticesIn)
 {
-    if (!m_Triton || verticesIn.Num() == 0)
+    if (!m_Triton || IsAceFileLoadPending() || verticesIn.Num() == 0)
     {
         return false;
     }
@@ -251,7 +404,7 @@ bool FProjectAcousticsModule::AddDynamicOpening(
 
 bool FProjectAcousticsModule::RemoveDynamicOpening(class UAcousticsDynamicOpening* opening)
 {
-    if (!m_Triton)
+    if (!m_Triton || IsAceFileLoadPending())
     {
         return false;
     }
@@ -262,7 +415,7 @@ bool FProjectAcousticsModule::RemoveDynamicOpening(class UAcousticsDynamicOpenin
 bool FProjectAcousticsModule::UpdateDynamicOpening(
     class UAcousticsDynamicOpening* opening, float dryAttenuationDb, float wetAttenuationDb)
 {
-    if (!m_Triton)
+    if (!m_Triton || IsAceFileLoadPending())
     {
         return false;
     }
@@ -287,6 +440,17 @@ bool FProjectAcousticsModule::UpdateWwiseParameters(
         return false;
     }
 
+    // While the ACE file is loading, play sounds as if there were no geometry rather than not at all
+    if (IsAceFileLoadPending())
+    {
+        UserDesign::Combine(wwiseParams.Design, m_GlobalDesign);
+        wwiseParams.ObjectId = akSourceObjectId;
+        wwiseParams.TritonParams = MakeFreefieldParameters(sourceLocation, listenerLocation);
+        wwiseParams.Outdoorness = 1;
+        CollectPluginData(wwiseParams);
+        return true;
+    }
+
     // Validate arguments
     if (!m_AceFileLoaded)
     {
@@ -372,11 +536,117 @@ bool FProjectAcousticsModule::PostTick()
         return false;
     }
 
+    CompletePendingAceLoad();
+    PublishPerfStats();
+    m_TritonMemHook->PublishStats();
+
     m_WwiseParamsCache.Empty();
     m_IsOutdoornessStale = true;
     return true;
 }
 
+bool FProjectAcousticsModule::GetPerfStats(TritonStats& outStats) const
+{
+    if (!m_Triton || !m_AceFileLoaded)
+    {
+        return false;
+    }
+
+    return m_Triton->GetPerfStats(outStats);
+}
+
+float FProjectAcousticsModule::GetMemoryBudgetMB() const
+{
+    if (m_MemoryBudgetOverrideMB > 0)
+    {
+        return m_MemoryBudgetOverrideMB;
+    }
+    return static_cast<float>(FMath::Max(c_MemoryBudgetMB, 0));
+}
+
+void FProjectAcousticsModule::ResetPerfStats()
+{
+    if (!m_Triton || !m_AceFileLoaded)
+    {
+        return;
+    }
+
+    m_Triton->StartCollectingStats();
+}
+
+// Mirrors Triton's stats into the stats system and CSV profiler, and periodically to the log
+void FProjectAcousticsModule::PublishPerfStats()
+{
+    TritonStats stats;
+    if (!GetPerfStats(stats))
+    {
+        return;
+    }
+
+    SET_DWORD_STAT(STAT_Acoustics_ProbesInRAM, stats.ProbesInRAM);
+    SET_DWORD_STAT(STAT_Acoustics_ProbesPendingLoad, stats.ProbesPendingLoad);
+    SET_DWORD_STAT(STAT_Acoustics_ProbesPendingUnload, stats.ProbesPendingUnload);
+    SET_DWORD_STAT(STAT_Acoustics_ProbesLoadFailed, stats.ProbesLoadFailed);
+    SET_DWORD_STAT(STAT_Acoustics_NumQueries, stats.NumQueries);
+    SET_DWORD_STAT(STAT_Acoustics_NumFailed, stats.NumFailed);
+    SET_DWORD_STAT(STAT_Acoustics_NumStreamingFailed, stats.NumStreamingFailed);
+    SET_FLOAT_STAT(STAT_Acoustics_AvgQueryTime, stats.AvgQueryTime);
+    SET_FLOAT_STAT(STAT_Acoustics_MaxQueryTime, stats.MaxQueryTime);
+    SET_DWORD_STAT(STAT_Acoustics_CacheQueries, stats.CacheQueries);
+    SET_DWORD_STAT(STAT_Acoustics_CacheHits, stats.CacheHits);
+
+    CSV_CUSTOM_STAT(Acoustics, ProbesInRAM, stats.ProbesInRAM, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(Acoustics, ProbesPendingLoad, stats.ProbesPendingLoad, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(Acoustics, NumQueries, stats.NumQueries, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(Acoustics, NumStreamingFailed, stats.NumStreamingFailed, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(Acoustics, AvgQueryTime, stats.AvgQueryTime, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(Acoustics, MaxQueryTime, stats.MaxQueryTime, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(Acoustics, CacheHits, stats.CacheHits, ECsvCustomStatOp::Set);
+
+    if (c_StatsLogInterval > 0)
+    {
+        const auto now = FPlatformTime::Seconds();
+        if (now - m_LastStatsLogTime >= c_StatsLogInterval)
+        {
+            m_LastStatsLogTime = now;
+            LogPerfStats();
+        }
+    }
+}
+
+void FProjectAcousticsModule::LogPerfStats() const
+{
+    TritonStats stats;
+    if (!GetPerfStats(stats))
+    {
+        UE_LOG(LogAcousticsRuntime, Log, TEXT("AcousticsStats: no ACE file loaded"));
+        return;
+    }
+
+    // Single key=value line so server logs can be parsed by tooling
+    UE_LOG(
+        LogAcousticsRuntime,
+        Log,
+        TEXT("AcousticsStats: ProbesInRAM=%d ProbesLoaded=%d ProbesLoadFailed=%d ProbesUnloaded=%d "
+             "ProbesPendingLoad=%d ProbesPendingUnload=%d NumQueries=%d NumFailed=%d NumStreamingFailed=%d "
+             "AvgQueryTime=%f MaxQueryTime=%f StdDevQueryTime=%f CacheQueries=%d CacheHits=%d MemoryUsed=%lld"),
+        stats.ProbesInRAM,
+        stats.ProbesLoaded,
+        stats.ProbesLoadFailed,
+        stats.ProbesUnloaded,
+        stats.ProbesPendingLoad,
+        stats.ProbesPendingUnload,
+        stats.NumQueries,
+        stats.NumFailed,
+        stats.NumStreamingFailed,
+        stats.AvgQueryTime,
+        stats.MaxQueryTime,
+        stats.StdDevQueryTime,
+        stats.CacheQueries,
+        stats.CacheHits,
+        m_TritonMemHook != nullptr ? m_TritonMemHook->GetTotalMemoryUsed() : 0ll);
+}
+
 // Collects data across emitters to send to Wwise mixer plugin
 void FProjectAcousticsModule::CollectPluginData(const TritonWwiseParams& params)
 {
@@ -395,7 +665,7 @@ void FProjectAcousticsModule::CollectPluginData(const TritonWwiseParams& params)
 
 bool FProjectAcousticsModule::UpdateDistances(const FVector& listenerLocation)
 {
-    if (!m_Triton)
+    if (!m_Triton || IsAceFileLoadPending())
     {
         return false;
     }
@@ -406,7 +676,7 @@ bool FProjectAcousticsModule::UpdateDistances(const FVector& listenerLocation)
 
 bool FProjectAcousticsModule::QueryDistance(const FVector& lookDirection, float& outDistance)
 {
-    if (!m_Triton)
+    if (!m_Triton || IsAceFileLoadPending())
     {
         outDistance = 0;
         return false;
@@ -419,7 +689,7 @@ bool FProjectAcousticsModule::QueryDistance(const FVector& lookDirection, float&
 
 bool FProjectAcousticsModule::UpdateOutdoorness(const FVector& listenerLocation)
 {
-    if (!m_Triton)
+    if (!m_Triton || IsAceFileLoadPending())
     {
         return false;
     }
@@ -458,6 +728,13 @@ inline float FProjectAcousticsModule::GetOutdoorness() const
 
 bool FProjectAcousticsModule::QueryAcoustics(const int sourceId, const FVector& sourceLocation, const FVector& listenerLocation, TritonAcousticParameters& outParams)
 {
+    // Not ready yet. Fill in free-field parameters for callers that want something to play with.
+    if (!m_Triton || IsAceFileLoadPending())
+    {
+        outParams = MakeFreefieldParameters(sourceLocation, listenerLocation);
+        return false;
+    }
+
     TritonWwiseParams params;
     QueryDebugInfo qdi;
     bool retVal = GetAcousticParameters(sourceLocation, listenerLocation, outParams,nullptr, &qdi);
@@ -468,6 +745,17 @@ bool FProjectAcousticsModule::QueryAcoustics(const int sourceId, const FVector&
     return retVal;
 }
 
+bool FProjectAcousticsModule::QueryAcousticsNoDebug(
+    const FVector& sourceLocation, const FVector& listenerLocation, TritonAcousticParameters& outParams)
+{
+    if (!m_Triton || !m_AceFileLoaded || IsAceFileLoadPending())
+    {
+        return false;
+    }
+
+    return GetAcousticParameters(sourceLocation, listenerLocation, outParams, nullptr);
+}
+
 bool FProjectAcousticsModule::GetAcousticParameters(
     const FVector& sourceLocation, const FVector& listenerLocation, TritonAcousticParameters& params,
     TritonDynamicOpeningInfo* outOpeningInfo, TritonRuntime::QueryDebugInfo* outDebugInfo /* = nullptr */)
@@ -505,7 +793,8 @@ void FProjectAcousticsModule::UpdateLoadedRegion(
     const FVector& playerPosition, const FVector& tileSize, const bool forceUpdate, const bool unloadProbesOutsideTile,
     const bool blockOnCompletion)
 {
-    if (!m_Triton)
+    // Nothing to stream until the ACE file has finished loading
+    if (!m_Triton || IsAceFileLoadPending())
     {
         return;
     }
@@ -514,6 +803,34 @@ void FProjectAcousticsModule::UpdateLoadedRegion(
     const auto loadThreshold = m_LastLoadTileSize * c_AceTileLoadMargin * 0.5f;
     bool shouldUpdate = forceUpdate || (difference.X > loadThreshold.X || difference.Y > loadThreshold.Y ||
                                         difference.Z > loadThreshold.Z);
+    ApplyMemoryBudget();
+    if (shouldUpdate && m_TritonMemHook->IsOverBudget() && m_TritonMemHook->IsPooled())
+    {
+        // Free blocks held by the pool count against the budget, release them before giving up
+        m_TritonMemHook->TrimPool();
+    }
+    if (shouldUpdate && m_TritonMemHook->IsOverBudget() &&
+        !CanLoadRegionOverBudget(tileSize, m_LastLoadTileSize, forceUpdate, unloadProbesOutsideTile))
+    {
+        // Loading more data would only grow memory further. Keep what is loaded and try again
+        // once memory has come back under budget.
+        if (!m_IsStreamingPausedForBudget)
+        {
+            UE_LOG(
+                LogAcousticsRuntime,
+                Warning,
+                TEXT("Acoustics memory [%lld]MB is over budget [%.0f]MB, pausing ACE streaming"),
+                m_TritonMemHook->GetTotalMemoryUsed() >> 20,
+                GetMemoryBudgetMB());
+            m_IsStreamingPausedForBudget = true;
+        }
+        return;
+    }
+    if (!m_TritonMemHook->IsOverBudget())
+    {
+        m_IsStreamingPausedForBudget = false;
+    }
+
     if (shouldUpdate)
     {
         int loadedProbes = 0;
@@ -535,6 +852,28 @@ void FProjectAcousticsModule::UpdateLoadedRegion(
     }
 }
 
+void FProjectAcousticsModule::ApplyMemoryBudget()
+{
+    m_TritonMemHook->SetMemoryBudget(static_cast<int64>(GetMemoryBudgetMB() * 1024.0 * 1024.0));
+}
+
+bool FProjectAcousticsModule::CanLoadRegionOverBudget(
+    const FVector& tileSize, const FVector& lastLoadTileSize, bool forceUpdate, bool unloadProbesOutsideTile)
+{
+    // Without unloading, any load only adds probes
+    if (!unloadProbesOutsideTile)
+    {
+        return false;
+    }
+    // Forced reloads come from the budget shrinking the tile, they must get through to release memory
+    if (forceUpdate)
+    {
+        return true;
+    }
+    const auto size = tileSize.GetAbs();
+    return size.X <= lastLoadTileSize.X && size.Y <= lastLoadTileSize.Y && size.Z <= lastLoadTileSize.Z;
+}
+
 const TMap<uint64_t, TritonWwiseParams>& FProjectAcousticsModule::GetCachedWwiseParameters()
 {
     return m_WwiseParamsCache;
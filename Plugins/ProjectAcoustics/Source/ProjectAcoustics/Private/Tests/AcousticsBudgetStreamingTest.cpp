@@ -0,0 +1,99 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "Misc/AutomationTest.h"
+#include "ProjectAcoustics.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    // Stand-in for the loaded region: probes are spread evenly over the horizontal tile area, and unloading
+    // probes outside the tile brings memory back down to what the tile holds.
+    struct FBudgetStreamingModel
+    {
+        double BytesPerUnitArea;
+        double BudgetBytes;
+        double MemoryUsed = 0;
+        FVector LastLoadTileSize = FVector::ZeroVector;
+        bool IsStreamingPaused = false;
+
+        double TileBytes(const FVector& tileSize) const
+        {
+            return BytesPerUnitArea * tileSize.X * tileSize.Y;
+        }
+
+        bool IsOverBudget() const
+        {
+            return MemoryUsed >= BudgetBytes;
+        }
+
+        // Mirrors the budget gate in FProjectAcousticsModule::UpdateLoadedRegion
+        void UpdateLoadedRegion(const FVector& tileSize, bool forceUpdate, bool unloadProbesOutsideTile)
+        {
+            if (IsOverBudget() && !FProjectAcousticsModule::CanLoadRegionOverBudget(
+                                      tileSize, LastLoadTileSize, forceUpdate, unloadProbesOutsideTile))
+            {
+                IsStreamingPaused = true;
+                return;
+            }
+            if (!IsOverBudget())
+            {
+                IsStreamingPaused = false;
+            }
+
+            MemoryUsed = unloadProbesOutsideTile ? TileBytes(tileSize) : FMath::Max(MemoryUsed, TileBytes(tileSize));
+            LastLoadTileSize = tileSize;
+        }
+    };
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FAcousticsBudgetStreamingTest, "ProjectAcoustics.Streaming.ShrunkTileRecoversFromOverBudget",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAcousticsBudgetStreamingTest::RunTest(const FString& Parameters)
+{
+    const FVector largeTile(10000, 10000, 5000);
+    const FVector smallTile(5000, 5000, 5000);
+
+    FBudgetStreamingModel model;
+    model.BytesPerUnitArea = 1.0;
+    model.BudgetBytes = 0.5 * model.TileBytes(largeTile);
+
+    // The first tile is loaded before memory is known, and lands over budget
+    model.UpdateLoadedRegion(largeTile, true, true);
+    TestTrue(TEXT("Large tile is over budget"), model.IsOverBudget());
+
+    // Loading without unloading can only grow memory, so it is refused
+    const double usedBeforeRefusal = model.MemoryUsed;
+    model.UpdateLoadedRegion(largeTile, false, false);
+    TestTrue(TEXT("Growing load is refused while over budget"), model.IsStreamingPaused);
+    TestEqual(TEXT("Refused load leaves memory alone"), model.MemoryUsed, usedBeforeRefusal);
+
+    // The budget shrinks the tile and forces a reload that unloads probes outside it
+    model.UpdateLoadedRegion(smallTile, true, true);
+    TestTrue(TEXT("Shrunk tile releases memory"), model.MemoryUsed < usedBeforeRefusal);
+    TestFalse(TEXT("Shrunk tile is under budget"), model.IsOverBudget());
+
+    // Regular streaming as the listener moves goes through again
+    model.UpdateLoadedRegion(smallTile, false, true);
+    TestFalse(TEXT("Streaming resumes once under budget"), model.IsStreamingPaused);
+
+    // Direct checks of the gate
+    TestTrue(
+        TEXT("Same size unloading load is allowed"),
+        FProjectAcousticsModule::CanLoadRegionOverBudget(smallTile, smallTile, false, true));
+    TestFalse(
+        TEXT("Larger unloading load is refused"),
+        FProjectAcousticsModule::CanLoadRegionOverBudget(largeTile, smallTile, false, true));
+    TestTrue(
+        TEXT("Forced unloading load is allowed"),
+        FProjectAcousticsModule::CanLoadRegionOverBudget(largeTile, smallTile, true, true));
+    TestFalse(
+        TEXT("Forced load without unloading is refused"),
+        FProjectAcousticsModule::CanLoadRegionOverBudget(smallTile, largeTile, true, false));
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -7,6 +7,10 @@
 #include "HAL/PlatformFilemanager.h"
 
 DEFINE_STAT(STAT_Acoustics_Memory);
+DEFINE_STAT(STAT_Acoustics_PoolFree);
+DEFINE_STAT(STAT_Acoustics_PoolSlack);
+DEFINE_STAT(STAT_Acoustics_PoolAllocs);
+DEFINE_STAT(STAT_Acoustics_PoolAllocLatency);
 DEFINE_STAT(STAT_Acoustics_FileReads);
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -56,6 +60,254 @@ namespace TritonRuntime
         }
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// POOLED ALLOCATOR
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////
+    namespace
+    {
+        // Prefixed to every pooled block. Its size keeps the payload at the 16-byte alignment Triton expects.
+        struct FBlockHeader
+        {
+            uint64 RequestedSize;
+            int32 SizeClass;
+            uint32 Padding;
+        };
+        static_assert(sizeof(FBlockHeader) == 16, "Block header must preserve 16-byte alignment");
+
+        // Blocks kept per size class in each thread's cache before spilling to the global freelist
+        constexpr int32 c_ThreadCacheDepth = 32;
+
+        uint64 SizeOfClass(int32 sizeClass)
+        {
+            const int32 log2 = FTritonPooledAllocator::MinClassLog2 + sizeClass / 2;
+            return (sizeClass & 1) ? (3ull << (log2 - 1)) : (1ull << log2);
+        }
+
+        // Returns INDEX_NONE for sizes larger than the biggest class
+        int32 SizeToClass(uint64 size)
+        {
+            if (size <= (1ull << FTritonPooledAllocator::MinClassLog2))
+            {
+                return 0;
+            }
+
+            const int32 log2 = FMath::CeilLogTwo64(size);
+            if (log2 > FTritonPooledAllocator::MaxClassLog2)
+            {
+                return INDEX_NONE;
+            }
+
+            // Between 2^(log2-1) and 2^log2: use the 1.5 * 2^(log2-1) class if it fits
+            const int32 sizeClass = (log2 - FTritonPooledAllocator::MinClassLog2) * 2;
+            return size <= (3ull << (log2 - 2)) ? sizeClass - 1 : sizeClass;
+        }
+    } // namespace
+
+    struct FTritonPooledAllocator::FThreadCache
+    {
+        void* Blocks[NumSizeClasses][c_ThreadCacheDepth];
+        int32 Count[NumSizeClasses];
+
+        // Written only by the owning thread, summed across threads by GetStats().
+        // Per-thread values can go negative when blocks are freed on another thread.
+        FStats Stats;
+
+        FThreadCache()
+        {
+            FMemory::Memzero(Count);
+            FMemory::Memzero(Stats);
+        }
+    };
+
+    FTritonPooledAllocator::FTritonPooledAllocator() : m_TlsSlot(FPlatformTLS::AllocTlsSlot())
+    {
+    }
+
+    FTritonPooledAllocator::~FTritonPooledAllocator()
+    {
+        // Called after Triton's TearDown, no other thread can be using the pool anymore
+        Trim();
+        for (auto* cache : m_ThreadCaches)
+        {
+            for (int32 sizeClass = 0; sizeClass < NumSizeClasses; sizeClass++)
+            {
+                for (int32 i = 0; i < cache->Count[sizeClass]; i++)
+                {
+                    FMemory::Free(cache->Blocks[sizeClass][i]);
+                }
+            }
+            delete cache;
+        }
+        m_ThreadCaches.Empty();
+        FPlatformTLS::FreeTlsSlot(m_TlsSlot);
+    }
+
+    FTritonPooledAllocator::FThreadCache& FTritonPooledAllocator::GetThreadCache()
+    {
+        auto* cache = static_cast<FThreadCache*>(FPlatformTLS::GetTlsValue(m_TlsSlot));
+        if (cache == nullptr)
+        {
+            cache = new FThreadCache();
+            {
+                FScopeLock lock(&m_ThreadCachesLock);
+                m_ThreadCaches.Add(cache);
+            }
+            FPlatformTLS::SetTlsValue(m_TlsSlot, cache);
+        }
+        return *cache;
+    }
+
+    void* FTritonPooledAllocator::Malloc(size_t size)
+    {
+#if !UE_BUILD_SHIPPING
+        const uint32 startCycles = FPlatformTime::Cycles();
+#endif
+        auto& cache = GetThreadCache();
+        const int32 sizeClass = SizeToClass(size);
+
+        FBlockHeader* header = nullptr;
+        uint64 blockSize = size;
+        if (sizeClass != INDEX_NONE)
+        {
+            blockSize = SizeOfClass(sizeClass);
+            if (cache.Count[sizeClass] > 0)
+            {
+                header = static_cast<FBlockHeader*>(cache.Blocks[sizeClass][--cache.Count[sizeClass]]);
+                cache.Stats.BytesCached -= blockSize;
+            }
+            else
+            {
+                header = static_cast<FBlockHeader*>(m_FreeLists[sizeClass].Pop());
+                if (header != nullptr)
+                {
+                    cache.Stats.BytesFree -= blockSize;
+                }
+            }
+        }
+
+        if (header == nullptr)
+        {
+            header = static_cast<FBlockHeader*>(FMemory::Malloc(sizeof(FBlockHeader) + blockSize, 16));
+            if (header == nullptr)
+            {
+                return nullptr;
+            }
+        }
+
+        header->RequestedSize = size;
+        header->SizeClass = sizeClass;
+        cache.Stats.BytesInUse += blockSize;
+        cache.Stats.BytesRequested += size;
+        cache.Stats.NumAllocs++;
+#if !UE_BUILD_SHIPPING
+        cache.Stats.AllocCycles += FPlatformTime::Cycles() - startCycles;
+#endif
+
+        return header + 1;
+    }
+
+    void* FTritonPooledAllocator::Realloc(void* inPtr, size_t size)
+    {
+        if (inPtr == nullptr)
+        {
+            return Malloc(size);
+        }
+
+        if (size == 0)
+        {
+            Free(inPtr);
+            return nullptr;
+        }
+
+        // Still fits the same size class, just update the bookkeeping
+        auto* header = static_cast<FBlockHeader*>(inPtr) - 1;
+        const int32 sizeClass = SizeToClass(size);
+        if (sizeClass != INDEX_NONE && sizeClass == header->SizeClass)
+        {
+            auto& cache = GetThreadCache();
+            cache.Stats.BytesRequested += static_cast<int64>(size) - static_cast<int64>(header->RequestedSize);
+            header->RequestedSize = size;
+            return inPtr;
+        }
+
+        void* outPtr = Malloc(size);
+        if (outPtr != nullptr)
+        {
+            FMemory::Memcpy(outPtr, inPtr, FMath::Min<uint64>(size, header->RequestedSize));
+            Free(inPtr);
+        }
+        return outPtr;
+    }
+
+    void FTritonPooledAllocator::Free(void* inPtr)
+    {
+        if (inPtr == nullptr)
+        {
+            return;
+        }
+
+        auto& cache = GetThreadCache();
+        auto* header = static_cast<FBlockHeader*>(inPtr) - 1;
+        const int32 sizeClass = header->SizeClass;
+        const uint64 blockSize = sizeClass != INDEX_NONE ? SizeOfClass(sizeClass) : header->RequestedSize;
+
+        cache.Stats.BytesInUse -= blockSize;
+        cache.Stats.BytesRequested -= header->RequestedSize;
+
+        if (sizeClass == INDEX_NONE)
+        {
+            FMemory::Free(header);
+            return;
+        }
+
+        // Thread cache is full, spill half of it so the next frees don't spill again right away
+        if (cache.Count[sizeClass] == c_ThreadCacheDepth)
+        {
+            for (int32 i = c_ThreadCacheDepth / 2; i < c_ThreadCacheDepth; i++)
+            {
+                m_FreeLists[sizeClass].Push(cache.Blocks[sizeClass][i]);
+            }
+            cache.Count[sizeClass] = c_ThreadCacheDepth / 2;
+            const int64 spilledBytes = static_cast<int64>(blockSize) * (c_ThreadCacheDepth - c_ThreadCacheDepth / 2);
+            cache.Stats.BytesCached -= spilledBytes;
+            cache.Stats.BytesFree += spilledBytes;
+        }
+
+        cache.Blocks[sizeClass][cache.Count[sizeClass]++] = header;
+        cache.Stats.BytesCached += blockSize;
+    }
+
+    void FTritonPooledAllocator::Trim()
+    {
+        auto& cache = GetThreadCache();
+        for (int32 sizeClass = 0; sizeClass < NumSizeClasses; sizeClass++)
+        {
+            while (void* block = m_FreeLists[sizeClass].Pop())
+            {
+                FMemory::Free(block);
+                cache.Stats.BytesFree -= SizeOfClass(sizeClass);
+            }
+        }
+    }
+
+    FTritonPooledAllocator::FStats FTritonPooledAllocator::GetStats() const
+    {
+        FStats total;
+        FMemory::Memzero(total);
+
+        FScopeLock lock(&m_ThreadCachesLock);
+        for (const auto* cache : m_ThreadCaches)
+        {
+            total.BytesInUse += cache->Stats.BytesInUse;
+            total.BytesRequested += cache->Stats.BytesRequested;
+            total.BytesFree += cache->Stats.BytesFree;
+            total.BytesCached += cache->Stats.BytesCached;
+            total.NumAllocs += cache->Stats.NumAllocs;
+            total.AllocCycles += cache->Stats.AllocCycles;
+        }
+        return total;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// MEM HOOK
     /////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -63,28 +315,42 @@ namespace TritonRuntime
 
     inline void* FTritonMemHook::Malloc(size_t inSize)
     {
+        // Pool does its own accounting, published once per frame by PublishStats()
+        if (m_Pool)
+        {
+            return m_Pool->Malloc(inSize);
+        }
+
         void* outPtr = FMemory::Malloc(inSize, 16);
 
-#if !UE_BUILD_SHIPPING
-        // Allocated block size can be larger than requested, get the actual size.
-        // (Note that this deals with nullptr correctly)
-        auto allocSize = FMemory::GetAllocSize(outPtr);
-        INC_MEMORY_STAT_BY(STAT_Acoustics_Memory, allocSize);
-        FPlatformAtomics::InterlockedAdd(&m_TotalMemoryUsed, static_cast<int64>(allocSize));
-#endif //! UE_BUILD_SHIPPING
+        if (ShouldTrackMemory())
+        {
+            // Allocated block size can be larger than requested, get the actual size.
+            // (Note that this deals with nullptr correctly)
+            auto allocSize = FMemory::GetAllocSize(outPtr);
+            INC_MEMORY_STAT_BY(STAT_Acoustics_Memory, allocSize);
+            FPlatformAtomics::InterlockedAdd(&m_TotalMemoryUsed, static_cast<int64>(allocSize));
+        }
 
         return outPtr;
     }
 
     void* FTritonMemHook::Realloc(void* inPtr, size_t size)
     {
-#if !UE_BUILD_SHIPPING
+        if (m_Pool)
+        {
+            return m_Pool->Realloc(inPtr, size);
+        }
+
+        if (!ShouldTrackMemory())
+        {
+            return FMemory::Realloc(inPtr, size, 16);
+        }
+
         int64 oldSize = FMemory::GetAllocSize(inPtr);
-#endif
 
         void* outPtr = FMemory::Realloc(inPtr, size, 16);
 
-#if !UE_BUILD_SHIPPING
         int64 newSize = FMemory::GetAllocSize(outPtr);
 
         // Increment counters if new size is larger, decrement otherwise
@@ -98,30 +364,100 @@ namespace TritonRuntime
             DEC_MEMORY_STAT_BY(STAT_Acoustics_Memory, oldSize - newSize);
             FPlatformAtomics::InterlockedAdd(&m_TotalMemoryUsed, -static_cast<int64>(oldSize - newSize));
         }
-#endif //! UE_BUILD_SHIPPING
 
         return outPtr;
     }
 
     void FTritonMemHook::Free(void* inPtr)
     {
-#if !UE_BUILD_SHIPPING
-        // note that this deals will nullptr correctly
-        auto AllocSize = FMemory::GetAllocSize(inPtr);
-        DEC_MEMORY_STAT_BY(STAT_Acoustics_Memory, AllocSize);
-        FPlatformAtomics::InterlockedAdd(&m_TotalMemoryUsed, -static_cast<int64>(AllocSize));
-#endif //! UE_BUILD_SHIPPING
+        if (m_Pool)
+        {
+            m_Pool->Free(inPtr);
+            return;
+        }
+
+        if (ShouldTrackMemory())
+        {
+            // note that this deals will nullptr correctly
+            auto AllocSize = FMemory::GetAllocSize(inPtr);
+            DEC_MEMORY_STAT_BY(STAT_Acoustics_Memory, AllocSize);
+            FPlatformAtomics::InterlockedAdd(&m_TotalMemoryUsed, -static_cast<int64>(AllocSize));
+        }
 
         FMemory::Free(inPtr);
     }
 
-    FTritonMemHook::FTritonMemHook() : m_TotalMemoryUsed(0)
+    FTritonMemHook::FTritonMemHook(bool usePool) : m_TotalMemoryUsed(0), m_MemoryBudget(0), m_IsTrackingMemory(0)
     {
+        if (usePool)
+        {
+            m_Pool = MakeUnique<FTritonPooledAllocator>();
+        }
+        FMemory::Memzero(m_LastPublishedPoolStats);
     }
 
     int64 FTritonMemHook::GetTotalMemoryUsed() const
     {
-        return m_TotalMemoryUsed;
+        if (m_Pool)
+        {
+            // Free blocks in the global freelists are still held from the system, count them too.
+            // Thread caches are left out, Trim() can't release them.
+            const auto stats = m_Pool->GetStats();
+            return stats.BytesInUse + stats.BytesFree;
+        }
+        // Frees of blocks allocated before tracking started can take the total below zero
+        return FMath::Max<int64>(m_TotalMemoryUsed, 0);
+    }
+
+    void FTritonMemHook::SetMemoryBudget(int64 budgetBytes)
+    {
+        FPlatformAtomics::InterlockedExchange(&m_MemoryBudget, FMath::Max<int64>(budgetBytes, 0));
+        // Never turned off again, or the frees of tracked blocks would go uncounted
+        if (budgetBytes > 0 && !m_IsTrackingMemory)
+        {
+            FPlatformAtomics::InterlockedExchange(&m_IsTrackingMemory, 1);
+        }
+    }
+
+    int64 FTritonMemHook::GetMemoryBudget() const
+    {
+        return m_MemoryBudget;
+    }
+
+    bool FTritonMemHook::IsOverBudget() const
+    {
+        const int64 budget = m_MemoryBudget;
+        return budget > 0 && GetTotalMemoryUsed() >= budget;
+    }
+
+    void FTritonMemHook::TrimPool()
+    {
+        if (m_Pool)
+        {
+            m_Pool->Trim();
+        }
+    }
+
+    void FTritonMemHook::PublishStats()
+    {
+        if (!m_Pool)
+        {
+            return;
+        }
+
+        const auto stats = m_Pool->GetStats();
+        SET_MEMORY_STAT(STAT_Acoustics_Memory, stats.BytesInUse);
+        SET_MEMORY_STAT(STAT_Acoustics_PoolFree, stats.BytesFree + stats.BytesCached);
+        SET_MEMORY_STAT(STAT_Acoustics_PoolSlack, stats.BytesInUse - stats.BytesRequested);
+
+        // Allocation count and latency are reported for the last frame only
+        const int64 numAllocs = stats.NumAllocs - m_LastPublishedPoolStats.NumAllocs;
+        const uint64 allocCycles = stats.AllocCycles - m_LastPublishedPoolStats.AllocCycles;
+        SET_DWORD_STAT(STAT_Acoustics_PoolAllocs, numAllocs);
+        SET_FLOAT_STAT(
+            STAT_Acoustics_PoolAllocLatency,
+            numAllocs > 0 ? FPlatformTime::ToMilliseconds64(allocCycles) * 1000.0 / numAllocs : 0.0);
+        m_LastPublishedPoolStats = stats;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -6,6 +6,7 @@
 #include "Core.h"
 #include "TritonHooks.h"
 #include "Async/AsyncFileHandle.h"
+#include "Containers/LockFreeList.h"
 #include "Stats/Stats2.h"
 #include "IAcoustics.h"
 
@@ -21,18 +22,99 @@ namespace TritonRuntime
         virtual void Log(ITritonLogHook::LogType type, const char* categoryName, const char* message) override;
     };
 
+    // Size-class pool for Triton's heap traffic. Probe streaming allocates and frees many blocks
+    // of the same few sizes, so requests are rounded up to a size class and recycled through
+    // per-thread caches backed by global lock-free freelists. Each block carries a 16 byte header
+    // with its size, which keeps accounting exact without calls to FMemory::GetAllocSize.
+    // All operations are thread-safe.
+    class FTritonPooledAllocator
+    {
+    public:
+        struct FStats
+        {
+            // Bytes handed out to Triton, rounded up to size class
+            int64 BytesInUse;
+            // Bytes Triton actually asked for. The difference to BytesInUse is size class slack.
+            int64 BytesRequested;
+            // Bytes sitting in the global freelists, ready for reuse and released by Trim()
+            int64 BytesFree;
+            // Bytes sitting in per-thread caches. Only their owning thread can touch them, so they stay
+            // allocated until it reuses them, at most c_ThreadCacheDepth blocks per size class and thread.
+            int64 BytesCached;
+            int64 NumAllocs;
+            uint64 AllocCycles;
+        };
+
+        FTritonPooledAllocator();
+        ~FTritonPooledAllocator();
+        void* Malloc(size_t size);
+        void* Realloc(void* inPtr, size_t size);
+        void Free(void* inPtr);
+
+        // Releases blocks in the global freelists back to FMemory.
+        // Blocks held in per-thread caches are kept, they are not counted against the memory budget.
+        void Trim();
+        FStats GetStats() const;
+
+        // Size classes go from 16 bytes to 64KB in steps of 2^n and 1.5 * 2^n.
+        // Larger blocks go straight to FMemory.
+        static constexpr int32 MinClassLog2 = 4;
+        static constexpr int32 MaxClassLog2 = 16;
+        static constexpr int32 NumSizeClasses = (MaxClassLog2 - MinClassLog2) * 2 + 1;
+
+    private:
+        struct FThreadCache;
+        FThreadCache& GetThreadCache();
+
+        uint32 m_TlsSlot;
+        TArray<FThreadCache*> m_ThreadCaches;
+        mutable FCriticalSection m_ThreadCachesLock;
+        TLockFreePointerListUnordered<void, PLATFORM_CACHE_LINE_SIZE> m_FreeLists[NumSizeClasses];
+    };
+
     // Implements the interface for memory alloc/dealloc operations. All operations *must* be thread-safe.
-    // Routes all of Triton's internal new/deletes to UE's FMemory::* versions.
+    // Routes all of Triton's internal new/deletes to UE's FMemory::* versions, optionally through
+    // FTritonPooledAllocator.
     class FTritonMemHook : public ITritonMemHook
     {
         volatile int64 m_TotalMemoryUsed;
+        volatile int64 m_MemoryBudget;
+        // Set once a budget is set, allocation sizes are only looked up from then on in shipping builds
+        volatile int32 m_IsTrackingMemory;
+        TUniquePtr<FTritonPooledAllocator> m_Pool;
+        FTritonPooledAllocator::FStats m_LastPublishedPoolStats;
         virtual void* Malloc(size_t inSize);
         virtual void* Realloc(void* inPtr, size_t size);
         virtual void Free(void* inPtr);
 
     public:
-        FTritonMemHook();
+        explicit FTritonMemHook(bool usePool = false);
+        // Memory held on behalf of Triton, including free blocks in the pool's global freelists.
         int64 GetTotalMemoryUsed() const;
+
+        // Hard cap in bytes on memory used by Triton, 0 means no limit. Allocations are never refused,
+        // the budget is enforced by not streaming in more data while over it.
+        // Without the pool, shipping builds only count memory from the first time a budget is set,
+        // so set it before loading an ACE file.
+        void SetMemoryBudget(int64 budgetBytes);
+        int64 GetMemoryBudget() const;
+        bool IsOverBudget() const;
+
+        bool IsPooled() const
+        {
+            return m_Pool.IsValid();
+        }
+
+        // The stat needs sizes in non-shipping builds, the budget in all builds
+        bool ShouldTrackMemory() const
+        {
+            return !UE_BUILD_SHIPPING || m_IsTrackingMemory != 0;
+        }
+
+        // Returns unused pooled memory to the system
+        void TrimPool();
+        // Publishes pool stats next to STAT_Acoustics_Memory. Call once per frame.
+        void PublishStats();
     };
 
     // Handles file I/O for UFS.
@@ -103,5 +185,10 @@ namespace TritonRuntime
 } // namespace TritonRuntime
 
 DECLARE_MEMORY_STAT_EXTERN(TEXT("Acoustics Memory Usage"), STAT_Acoustics_Memory, STATGROUP_Acoustics, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Acoustics Pool Free"), STAT_Acoustics_PoolFree, STATGROUP_Acoustics, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Acoustics Pool Slack"), STAT_Acoustics_PoolSlack, STATGROUP_Acoustics, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Acoustics Allocs"), STAT_Acoustics_PoolAllocs, STATGROUP_Acoustics, );
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(
+    TEXT("Acoustics Alloc Latency (us)"), STAT_Acoustics_PoolAllocLatency, STATGROUP_Acoustics, );
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
     TEXT("Acoustics Total Bytes Read"), STAT_Acoustics_FileReads, STATGROUP_Acoustics, );
\ No newline at end of file
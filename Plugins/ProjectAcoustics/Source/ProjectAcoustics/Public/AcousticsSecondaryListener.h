@@ -7,6 +7,7 @@
 
 #include "Engine/GameEngine.h"
 #include "IAcoustics.h"
+#include "AcousticsStimulusBus.h"
 #include "Containers/Array.h"
 #include "AcousticsSecondaryListener.generated.h"
 
@@ -87,6 +88,14 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Acoustics")
     bool ConsiderAmbiences = true;
 
+    // React to one-shot sounds posted to FAcousticsStimulusBus, such as gunfire, in addition to TargetObjects
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Acoustics")
+    bool ListenToStimuli = true;
+
+    // How long a one-shot sound keeps drawing the agent's attention after it was made, in seconds
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Acoustics", meta = (UIMin = 0, ClampMin = 0, UIMax = 10, ClampMax = 10))
+    float StimulusMemorySeconds = 1.0f;
+
     UFUNCTION(BlueprintCallable, Category = "Acoustics")
     FVector GetAudioLookDirection() { return m_CurrentVelocity; }
 
@@ -114,6 +123,7 @@ private:
     void AccumulatePolicyInputs();
     void AccumulateTargets();
     void AccumulateAmbiences();
+    void AccumulateStimuli();
 
     // Generate lookup tables.
     void GenerateMuLookupTable();
@@ -155,8 +165,14 @@ private:
     TArray<TritonAcousticParameters> m_AllAmbientParams;
 
     TArray<SourceEnergy> m_AllTargetEnergies;
+    // Actor that made each sound in m_AllTargetEnergies
+    TArray<TWeakObjectPtr<AActor>> m_AllTargetActors;
     TArray<SourceEnergy> m_AllAmbientEnergies;
 
+    // Stimuli read from the bus that are still remembered
+    uint64 m_StimulusCursor = 0;
+    TArray<FAcousticsStimulus> m_RecentStimuli;
+
     // Reflections accumulation vector.
     std::array<float, kNUM_DIRECTIONS> m_reflectEnergy = { 0 };
 
@@ -0,0 +1,68 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "IAcoustics.h"
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Stimuli Posted"), STAT_Acoustics_StimuliPosted, STATGROUP_Acoustics, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Stimuli Consumed"), STAT_Acoustics_StimuliConsumed, STATGROUP_Acoustics, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Stimuli Dropped"), STAT_Acoustics_StimuliDropped, STATGROUP_Acoustics, );
+
+// A one-shot sound that AI listeners may react to, like a gunshot or an impact
+struct FAcousticsStimulus
+{
+    FVector Location;
+    // Value is in dB, on the same scale as UAcousticsSecondarySource::SoundSourceLoudness
+    float LoudnessDb;
+    // World time in seconds when the sound was made
+    float Time;
+    TWeakObjectPtr<AActor> Instigator;
+    // Several worlds may be running in one process, e.g. PIE with multiple clients
+    TWeakObjectPtr<UWorld> World;
+};
+
+/**
+ * Fixed-size ring buffer of recent stimuli, shared by all listeners.
+ * Posting is lock-free and may happen from any thread. Each reader keeps its own cursor and only
+ * reads stimuli posted since its last read, so reading cost depends on how many sounds were made,
+ * not on how many things could make a sound. A reader that falls more than Capacity stimuli behind
+ * loses the oldest ones.
+ */
+class PROJECTACOUSTICS_API FAcousticsStimulusBus
+{
+public:
+    // Must be a power of two
+    static constexpr int64 Capacity = 256;
+
+    static FAcousticsStimulusBus& Get();
+
+    FAcousticsStimulusBus();
+
+    void Post(const FAcousticsStimulus& stimulus);
+    // Fills in time and world from the instigator
+    void Post(const FVector& location, float loudnessDb, AActor* instigator);
+
+    // A cursor that skips everything posted so far
+    uint64 GetCursor() const;
+
+    /**
+     * Appends stimuli posted after cursor to outStimuli and moves cursor past them.
+     *
+     * @return Number of stimuli that were overwritten before they could be read
+     */
+    int32 Consume(uint64& cursor, TArray<FAcousticsStimulus>& outStimuli) const;
+
+private:
+    struct FSlot
+    {
+        // Sequence number of the stimulus in this slot plus one. 0 while it is being written.
+        volatile int64 Tag;
+        FAcousticsStimulus Stimulus;
+    };
+
+    FSlot m_Slots[Capacity];
+    volatile int64 m_NextSequence;
+};
@@ -6,10 +6,14 @@
 #include "Modules/ModuleManager.h"
 #include "Stats/Stats.h"
 #include "TritonWwiseParams.h"
+#include "TritonPublicInterface.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogAcousticsRuntime, Log, All);
 DECLARE_STATS_GROUP(TEXT("Project Acoustics"), STATGROUP_Acoustics, STATCAT_Advanced);
 
+// Called on the game thread when an asynchronous ACE load finishes. Parameter is true on success.
+DECLARE_DELEGATE_OneParam(FAcousticsAceLoadComplete, bool);
+
 /**
  * The public interface to this module.  In most cases, this interface is only public to sibling modules
  * within this plugin.
@@ -49,6 +53,22 @@ public:
      */
     virtual bool LoadAceFile(const FString& filePath, const float cacheScale) = 0;
 
+    /**
+     * Starts loading the ACE file on a worker thread and returns immediately.
+     * Until the load completes, acoustic queries return free-field parameters and streaming requests are ignored.
+     * onComplete is called from PostTick() on the game thread once loading finishes. It is not called
+     * if the load is superseded by another load or by UnloadAceFile().
+     *
+     * @return True if the load was started
+     */
+    virtual bool
+    LoadAceFileAsync(const FString& filePath, const float cacheScale, FAcousticsAceLoadComplete onComplete) = 0;
+
+    /**
+     * @return True while an asynchronous ACE load is in flight
+     */
+    virtual bool IsAceFileLoadPending() const = 0;
+
     /**
      * Unload the currently loaded ACE file.
      */
@@ -99,6 +119,15 @@ public:
 
     virtual bool QueryAcoustics(const int sourceId, const FVector& sourceLocation, const FVector& listenerLocation, TritonAcousticParameters& outParams) = 0;
 
+    /**
+     * Same as QueryAcoustics, but doesn't record per-source debug info. For gameplay queries that aren't
+     * tied to a playing sound, such as server-side relevancy.
+     *
+     * @return True on success. False if the query failed or no ACE file is loaded.
+     */
+    virtual bool QueryAcousticsNoDebug(
+        const FVector& sourceLocation, const FVector& listenerLocation, TritonAcousticParameters& outParams) = 0;
+
     virtual bool UpdateOutdoorness(const FVector& listenerLocation) = 0;
     virtual float GetOutdoorness() const = 0;
 
@@ -142,6 +171,35 @@ public:
         const FVector& playerPosition, const FVector& tileSize, const bool forceUpdate,
         const bool unloadProbesOutsideTile, const bool blockOnCompletion) = 0;
 
+    /**
+     * Get Triton's internal streaming and query statistics, accumulated since the ACE file
+     * was loaded or since the last call to ResetPerfStats()
+     *
+     * @return True on success.
+     */
+    virtual bool GetPerfStats(TritonRuntime::TritonStats& outStats) const = 0;
+
+    /**
+     * Restart accumulation of Triton's internal statistics
+     */
+    virtual void ResetPerfStats() = 0;
+
+    /**
+     * Memory currently held by Triton, in bytes, including free blocks in the pooled allocator's freelists.
+     * Shipping builds without the pool only count memory once a memory budget is set.
+     */
+    virtual int64 GetMemoryUsed() const = 0;
+
+    /**
+     * Overrides the PA.MemoryBudgetMB console variable while > 0. Pass 0 to fall back to it.
+     */
+    virtual void SetMemoryBudgetOverride(float budgetMB) = 0;
+
+    /**
+     * Memory budget in effect, in MB. 0 means no limit.
+     */
+    virtual float GetMemoryBudgetMB() const = 0;
+
 #if !UE_BUILD_SHIPPING
     virtual void SetEnabled(bool isEnabled) = 0;
     virtual void
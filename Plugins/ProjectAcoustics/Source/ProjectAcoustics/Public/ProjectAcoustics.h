@@ -4,6 +4,7 @@
 #pragma once
 
 #include "Modules/ModuleManager.h"
+#include "Async/Future.h"
 #include "IAcoustics.h"
 #include "UnrealTritonHooks.h"
 #include "TritonWwiseParams.h"
@@ -25,6 +26,12 @@ public:
     // IAcoustics
     virtual bool LoadAceFile(const FString& filePath, const float cacheScale) override;
     virtual void UnloadAceFile() override;
+    virtual bool
+    LoadAceFileAsync(const FString& filePath, const float cacheScale, FAcousticsAceLoadComplete onComplete) override;
+    virtual bool IsAceFileLoadPending() const override
+    {
+        return m_PendingAceLoad.IsValid();
+    }
 
     virtual bool AddDynamicOpening(
         class UAcousticsDynamicOpening* opening, const FVector& center, const FVector& normal,
@@ -39,6 +46,8 @@ public:
         const uint64_t akSourceObjectId, const FVector& sourceLocation, const FVector& listenerLocation,
         TritonWwiseParams& parameters, struct TritonDynamicOpeningInfo* outOpeningInfo) override;
     virtual bool QueryAcoustics(const int sourceId, const FVector& sourceLocation, const FVector& listenerLocation, TritonAcousticParameters& outParams) override;
+    virtual bool QueryAcousticsNoDebug(
+        const FVector& sourceLocation, const FVector& listenerLocation, TritonAcousticParameters& outParams) override;
     virtual const TMap<uint64_t, TritonWwiseParams>& GetCachedWwiseParameters() override;
     virtual bool UpdateOutdoorness(const FVector& listenerLocation) override;
     virtual float GetOutdoorness() const override;
@@ -52,6 +61,28 @@ public:
     virtual void UpdateLoadedRegion(
         const FVector& playerPosition, const FVector& tileSize, const bool forceUpdate,
         const bool unloadProbesOutsideTile, const bool blockOnCompletion) override;
+    virtual bool GetPerfStats(TritonRuntime::TritonStats& outStats) const override;
+    virtual void ResetPerfStats() override;
+
+    virtual int64 GetMemoryUsed() const override
+    {
+        return m_TritonMemHook != nullptr ? m_TritonMemHook->GetTotalMemoryUsed() : 0;
+    }
+
+    virtual void SetMemoryBudgetOverride(float budgetMB) override
+    {
+        m_MemoryBudgetOverrideMB = FMath::Max(budgetMB, 0.0f);
+    }
+
+    virtual float GetMemoryBudgetMB() const override;
+
+    // Whether a LoadRegion request may go ahead while memory is over budget. Only requests that can't grow
+    // the loaded footprint are let through, so that a shrunk tile still unloads probes.
+    static bool CanLoadRegionOverBudget(
+        const FVector& tileSize, const FVector& lastLoadTileSize, bool forceUpdate, bool unloadProbesOutsideTile);
+
+    // Logs current Triton stats as a single key=value line
+    void LogPerfStats() const;
 
 #if !UE_BUILD_SHIPPING
     virtual void SetEnabled(bool isEnabled) override;
@@ -73,11 +104,6 @@ public:
         return m_AceFileLoaded;
     }
 
-    int64 GetMemoryUsed() const
-    {
-        return m_TritonMemHook != nullptr ? m_TritonMemHook->GetTotalMemoryUsed() : 0;
-    }
-
     int64 GetDiskBytesRead() const
     {
         return m_TritonIOHook != nullptr ? m_TritonIOHook->GetBytesRead() : 0;
@@ -100,6 +126,14 @@ private:
     bool m_IsOutdoornessStale;
     float m_CachedOutdoorness;
     UserDesign m_GlobalDesign;
+    double m_LastStatsLogTime;
+    bool m_IsStreamingPausedForBudget;
+    // Budget set by the acoustics space, takes precedence over PA.MemoryBudgetMB while > 0
+    float m_MemoryBudgetOverrideMB;
+    // InitLoad() running on a worker thread. No other Triton calls may be made while this is valid.
+    TFuture<bool> m_PendingAceLoad;
+    FString m_PendingAceFilePath;
+    FAcousticsAceLoadComplete m_OnAceLoadComplete;
 
 #if !UE_BUILD_SHIPPING
     bool m_IsEnabled;
@@ -111,6 +145,14 @@ private:
         const FVector& sourceLocation, const FVector& listenerLocation, TritonAcousticParameters& params,
         TritonDynamicOpeningInfo* outOpeningInfo, TritonRuntime::QueryDebugInfo* outDebugInfo = nullptr);
     void CollectPluginData(const TritonWwiseParams& params);
+    void PublishPerfStats();
+    bool OpenAceFile(const FString& fullFilePath);
+    void OnAceFileLoaded(const FString& filePath);
+    // Hands the budget in effect to the memory hook, which starts counting memory once a budget is set
+    void ApplyMemoryBudget();
+    void CompletePendingAceLoad();
+    // Blocks until an in-flight asynchronous load finishes. Its completion delegate is dropped.
+    void WaitForPendingAceLoad();
 };
 
 // Statistics hooks
@@ -120,3 +162,18 @@ DECLARE_CYCLE_STAT_EXTERN(TEXT("Query Outdoorness"), STAT_Acoustics_QueryOutdoor
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Load Region"), STAT_Acoustics_LoadRegion, STATGROUP_Acoustics, );
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Load Ace File"), STAT_Acoustics_LoadAce, STATGROUP_Acoustics, );
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Clear Ace File"), STAT_Acoustics_ClearAce, STATGROUP_Acoustics, );
+
+// Triton internal stats, published once per frame
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Probes In RAM"), STAT_Acoustics_ProbesInRAM, STATGROUP_Acoustics, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Probes Pending Load"), STAT_Acoustics_ProbesPendingLoad, STATGROUP_Acoustics, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(
+    TEXT("Probes Pending Unload"), STAT_Acoustics_ProbesPendingUnload, STATGROUP_Acoustics, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Probes Load Failed"), STAT_Acoustics_ProbesLoadFailed, STATGROUP_Acoustics, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Num Queries"), STAT_Acoustics_NumQueries, STATGROUP_Acoustics, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Num Failed Queries"), STAT_Acoustics_NumFailed, STATGROUP_Acoustics, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(
+    TEXT("Num Streaming Failed Queries"), STAT_Acoustics_NumStreamingFailed, STATGROUP_Acoustics, );
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Avg Query Time"), STAT_Acoustics_AvgQueryTime, STATGROUP_Acoustics, );
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Max Query Time"), STAT_Acoustics_MaxQueryTime, STATGROUP_Acoustics, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Cache Queries"), STAT_Acoustics_CacheQueries, STATGROUP_Acoustics, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Cache Hits"), STAT_Acoustics_CacheHits, STATGROUP_Acoustics, );
@@ -4,15 +4,50 @@
 #include "MathUtils.h"
 #include "EditorViewportClient.h"
 #include "Editor.h"
+#include "Runtime/CoreUObject/Public/UObject/ConstructorHelpers.h"
+#include "Materials/MaterialInstanceDynamic.h"
 
 using namespace TritonRuntime;
 
+// Edge length in voxels of the blocks the voxel surface is cached and culled in
+static constexpr int32 c_VoxelChunkSize = 16;
+// The engine cube is 100 units wide
+static constexpr float c_CubeMeshSize = 100.0f;
+
 AAcousticsDebugRenderer::AAcousticsDebugRenderer(const class FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
 {
     PrimaryActorTick.bCanEverTick = true;
     PrimaryActorTick.bStartWithTickEnabled = true;
+    m_ConfigChanged = false;
+    m_ProbesCached = false;
     m_VoxelInfoCached = false;
+    m_VoxelsShown = false;
+
+    // One instance per probe, culled per cluster by the renderer
+    m_ProbeInstances = CreateDefaultSubobject<UHierarchicalInstancedStaticMeshComponent>(TEXT("ProbeInstances"), true);
+    SetRootComponent(m_ProbeInstances);
+    m_ProbeInstances->SetFlags(RF_Transient);
+    m_ProbeInstances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    m_ProbeInstances->SetCastShadow(false);
+    m_ProbeInstances->SetHiddenInGame(true);
+
+    ConstructorHelpers::FObjectFinder<UStaticMesh> MeshAsset(TEXT("StaticMesh'/Engine/BasicShapes/Cube.Cube'"));
+    m_ProbeInstances->SetStaticMesh(MeshAsset.Object);
+
+    ConstructorHelpers::FObjectFinder<UMaterialInterface> MaterialAsset(
+        TEXT("Material'/Engine/BasicShapes/BasicShapeMaterial.BasicShapeMaterial'"));
+    UMaterialInterface* material = MaterialAsset.Object;
+    if (material)
+    {
+        m_ProbeInstances->SetMaterial(0, material);
+    }
+
+    // Persistent lines of the voxel surface in view, only re-submitted when the visible chunks change
+    m_VoxelLines = CreateDefaultSubobject<ULineBatchComponent>(TEXT("VoxelLines"), true);
+    m_VoxelLines->SetupAttachment(m_ProbeInstances);
+    m_VoxelLines->SetFlags(RF_Transient);
+    m_VoxelLines->SetHiddenInGame(true);
 }
 
 void AAcousticsDebugRenderer::SetConfiguration(TSharedPtr<AcousticsSimulationConfiguration> config)
@@ -20,9 +55,8 @@ void AAcousticsDebugRenderer::SetConfiguration(TSharedPtr<AcousticsSimulationCon
     FScopeLock lock(&m_Lock);
     m_Config = config;
 
-    // If the config is being reset, remove cached probes
-    m_ProbeLocations.Empty();
-    m_VoxelInfoCached = false;
+    // If the config is being reset, remove cached probes and voxels on the next tick
+    m_ConfigChanged = true;
 }
 
 bool AAcousticsDebugRenderer::ShouldTickIfViewportsOnly() const
@@ -34,40 +68,80 @@ void AAcousticsDebugRenderer::BeginPlay()
 {
     Super::BeginPlay();
     SetActorTickEnabled(false);
+
+    // Nothing of the preview belongs in play, whatever was copied from the editor world
+    m_ProbeInstances->ClearInstances();
+    m_ProbeInstances->SetVisibility(false);
+    m_VoxelLines->Flush();
+    m_VoxelLines->SetVisibility(false);
 }
 
+#if WITH_EDITOR
+void AAcousticsDebugRenderer::PreSave(const class ITargetPlatform* TargetPlatform)
+{
+    Super::PreSave(TargetPlatform);
+
+    // Keep probe instances out of the level package. The next tick rebuilds them.
+    m_ProbeInstances->ClearInstances();
+    m_ProbesCached = false;
+    HideVoxels();
+}
+#endif
+
 void AAcousticsDebugRenderer::UpdateCacheAndRender(FVector cameraPosition, FVector cameraDir, float cameraFOV)
 {
     // Hold a local reference used for rendering debug info
     TSharedPtr<AcousticsSimulationConfiguration> config;
+    bool configChanged = false;
     {
         FScopeLock lock(&m_Lock);
         config = m_Config;
+        configChanged = m_ConfigChanged;
+        m_ConfigChanged = false;
+    }
+
+    if (configChanged)
+    {
+        ClearCache();
+    }
+
+    if (!config.IsValid() || !config->IsReady())
+    {
+        return;
     }
 
     // Update rendering cache if needed
-    if (config.IsValid() && config->IsReady())
+    if (!m_ProbesCached)
     {
-        if (m_ProbeLocations.Num() == 0)
+        if (!config->GetProbeList(m_ProbeLocations, m_ProbeDepths, m_ProbeHeights))
         {
-            config->GetProbeList(m_ProbeLocations, m_ProbeDepths, m_ProbeHeights);
+            m_ProbeLocations.Reset();
+            m_ProbeDepths.Reset();
+            m_ProbeHeights.Reset();
         }
+        BuildProbeInstances();
+        m_ProbesCached = true;
+    }
 
-        if (!m_VoxelInfoCached)
+    if (!m_VoxelInfoCached)
+    {
+        m_VoxelInfoCached =
+            config->GetVoxelMapInfo(m_VoxelMapBounds, m_VoxelMapBoundsTriton, m_VoxelCounts, m_VoxelCellSize);
+        if (m_VoxelInfoCached)
         {
-            m_VoxelInfoCached =
-                config->GetVoxelMapInfo(m_VoxelMapBounds, m_VoxelMapBoundsTriton, m_VoxelCounts, m_VoxelCellSize);
+            InitVoxelChunks();
         }
+    }
 
-        if (ShouldRenderProbes)
-        {
-            RenderProbes();
-        }
+    m_ProbeInstances->SetVisibility(ShouldRenderProbes);
 
-        if (ShouldRenderVoxels)
-        {
-            RenderVoxels(config.Get(), cameraPosition, cameraDir, cameraFOV);
-        }
+    if (ShouldRenderVoxels && m_VoxelInfoCached)
+    {
+        RenderVoxels(config.Get(), cameraPosition, cameraDir, cameraFOV);
+    }
+    else
+    {
+        HideVoxels();
     }
 }
 
@@ -83,25 +157,41 @@ void AAcousticsDebugRenderer::Tick(float deltaSeconds)
     }
 }
 
+void AAcousticsDebugRenderer::ClearCache()
+{
+    m_ProbeLocations.Empty();
+    m_ProbeDepths.Empty();
+    m_ProbeHeights.Empty();
+    m_ProbesCached = false;
+    m_ProbeInstances->ClearInstances();
+
+    HideVoxels();
+    m_VoxelChunks.Empty();
+    m_VoxelInfoCached = false;
+}
+
 // Uncomment to also render the depth and height of the simulation region for each probe
 //#define RENDER_PROBE_DEPTH_HEIGHT
 
-void AAcousticsDebugRenderer::RenderProbes()
+void AAcousticsDebugRenderer::BuildProbeInstances()
 {
     const FVector probeBoxSize(10, 10, 10);
     const FColor probeBoxColor = FColor::Cyan;
 
-    auto* world = GetWorld();
-    if (!world)
+    m_ProbeInstances->ClearInstances();
+
+    UMaterialInstanceDynamic* material = m_ProbeInstances->CreateDynamicMaterialInstance(0);
+    if (material)
     {
-        return;
+        material->SetVectorParameterValue(TEXT("Color"), FLinearColor(probeBoxColor));
     }
 
+    // Box sizes are half extents, like DrawDebugBox
+    const FVector probeScale = probeBoxSize * 2.0f / c_CubeMeshSize;
     for (auto i = 0; i < m_ProbeLocations.Num(); i++)
     {
         const auto& location = m_ProbeLocations[i];
-        DrawDebugSolidBox(world, location, probeBoxSize, probeBoxColor);
-        DrawDebugBox(world, location, probeBoxSize, FColor::Black, false, -1.0f, 0, 2.0f);
+        m_ProbeInstances->AddInstanceWorldSpace(FTransform(FQuat::Identity, location, probeScale));
 
 #ifdef RENDER_PROBE_DEPTH_HEIGHT
         {
@@ -111,14 +201,19 @@ void AAcousticsDebugRenderer::RenderProbes()
 
             FVector ceilingPos = location + FVector(0, 0, height);
             FVector groundPos = location - FVector(0, 0, depth);
-            DrawDebugSolidBox(world, ceilingPos, planeSize, probeBoxColor);
-            DrawDebugBox(world, ceilingPos, planeSize, FColor::Black, false, -1.0f, 0, 2.0f);
-            DrawDebugSolidBox(world, groundPos, planeSize, probeBoxColor);
-            DrawDebugBox(world, groundPos, planeSize, FColor::Black, false, -1.0f, 0, 2.0f);
-            DrawDebugLine(world, groundPos, ceilingPos, probeBoxColor, false, -1.0f, 0, 2.0f);
+            const FVector planeScale = planeSize * 2.0f / c_CubeMeshSize;
+            m_ProbeInstances->AddInstanceWorldSpace(FTransform(FQuat::Identity, ceilingPos, planeScale));
+            m_ProbeInstances->AddInstanceWorldSpace(FTransform(FQuat::Identity, groundPos, planeScale));
+
+            // Thin column from ground to ceiling in place of a line
+            const FVector columnScale(0.02f, 0.02f, (height + depth) / c_CubeMeshSize);
+            m_ProbeInstances->AddInstanceWorldSpace(
+                FTransform(FQuat::Identity, (groundPos + ceilingPos) * 0.5f, columnScale));
         }
 #endif
     }
+
+    m_ProbeInstances->BuildTreeIfOutdated(true, false);
 }
 
 FIntVector AAcousticsDebugRenderer::MapPointToVoxel(const FVector& point) const
@@ -140,114 +235,237 @@ FVector AAcousticsDebugRenderer::MapVoxelToPoint(const FIntVector& voxel) const
     return TritonPositionToUnreal(pointTriton);
 }
 
+void AAcousticsDebugRenderer::InitVoxelChunks()
+{
+    m_VoxelChunkCounts = FIntVector(
+        FMath::DivideAndRoundUp(m_VoxelCounts.X, c_VoxelChunkSize),
+        FMath::DivideAndRoundUp(m_VoxelCounts.Y, c_VoxelChunkSize),
+        FMath::DivideAndRoundUp(m_VoxelCounts.Z, c_VoxelChunkSize));
+
+    m_VoxelChunks.Reset();
+    m_VoxelChunks.SetNum(m_VoxelChunkCounts.X * m_VoxelChunkCounts.Y * m_VoxelChunkCounts.Z);
+
+    // Edges of the voxel map, between corners that differ in exactly one axis.
+    // Zero lifetime keeps the lines until the line batch is flushed.
+    const auto voxelColor = FColor::Green;
+    m_VoxelMapBoundsLines.Reset();
+    for (int corner = 0; corner < 8; corner++)
+    {
+        const FVector start(
+            (corner & 1) ? m_VoxelMapBounds.Max.X : m_VoxelMapBounds.Min.X,
+            (corner & 2) ? m_VoxelMapBounds.Max.Y : m_VoxelMapBounds.Min.Y,
+            (corner & 4) ? m_VoxelMapBounds.Max.Z : m_VoxelMapBounds.Min.Z);
+        for (int axis = 0; axis < 3; axis++)
+        {
+            if ((corner & (1 << axis)) == 0)
+            {
+                FVector end = start;
+                end[axis] = m_VoxelMapBounds.Max[axis];
+                m_VoxelMapBoundsLines.Emplace(start, end, voxelColor, 0.0f, 0.0f, SDPG_World);
+            }
+        }
+    }
+
+    // Bounds are needed for culling before the chunk is built
+    const FVector halfCell(m_VoxelCellSize * 0.5f);
+    for (int x = 0; x < m_VoxelChunkCounts.X; x++)
+    {
+        for (int y = 0; y < m_VoxelChunkCounts.Y; y++)
+        {
+            for (int z = 0; z < m_VoxelChunkCounts.Z; z++)
+            {
+                const FIntVector minVoxel = FIntVector(x, y, z) * c_VoxelChunkSize;
+                const FIntVector maxVoxel(
+                    FMath::Min(minVoxel.X + c_VoxelChunkSize, m_VoxelCounts.X) - 1,
+                    FMath::Min(minVoxel.Y + c_VoxelChunkSize, m_VoxelCounts.Y) - 1,
+                    FMath::Min(minVoxel.Z + c_VoxelChunkSize, m_VoxelCounts.Z) - 1);
+
+                // The axes may be flipped between Triton and Unreal, so grow a box around both corner voxels
+                FBox bounds(ForceInit);
+                bounds += MapVoxelToPoint(minVoxel);
+                bounds += MapVoxelToPoint(maxVoxel);
+                m_VoxelChunks[(x * m_VoxelChunkCounts.Y + y) * m_VoxelChunkCounts.Z + z].Bounds =
+                    bounds.ExpandBy(halfCell);
+            }
+        }
+    }
+}
+
+void AAcousticsDebugRenderer::BuildVoxelChunk(const AcousticsSimulationConfiguration* config, int32 chunkIndex)
+{
+    const auto voxelColor = FColor::Green;
+    const auto voxelSize = FVector(m_VoxelCellSize);
+
+    AcousticsVoxelChunk& chunk = m_VoxelChunks[chunkIndex];
+    chunk.IsBuilt = true;
+
+    const int32 chunkZ = chunkIndex % m_VoxelChunkCounts.Z;
+    const int32 chunkY = (chunkIndex / m_VoxelChunkCounts.Z) % m_VoxelChunkCounts.Y;
+    const int32 chunkX = chunkIndex / (m_VoxelChunkCounts.Z * m_VoxelChunkCounts.Y);
+    const FIntVector minVoxel = FIntVector(chunkX, chunkY, chunkZ) * c_VoxelChunkSize;
+    const FIntVector maxVoxel(
+        FMath::Min(minVoxel.X + c_VoxelChunkSize, m_VoxelCounts.X),
+        FMath::Min(minVoxel.Y + c_VoxelChunkSize, m_VoxelCounts.Y),
+        FMath::Min(minVoxel.Z + c_VoxelChunkSize, m_VoxelCounts.Z));
+
+    // Read the occupancy of the chunk and a one voxel border at once, faces need their neighbors.
+    // Voxels outside of the map count as air.
+    const FIntVector paddedMin = minVoxel - FIntVector(1, 1, 1);
+    const FIntVector paddedCounts = maxVoxel - minVoxel + FIntVector(2, 2, 2);
+    TBitArray<> occupied;
+    if (!config->GetVoxelOccupancy(paddedMin, paddedMin + paddedCounts, occupied))
+    {
+        return;
+    }
+    auto occupiedIndex = [&paddedMin, &paddedCounts](int x, int y, int z) {
+        return ((x - paddedMin.X) * paddedCounts.Y + (y - paddedMin.Y)) * paddedCounts.Z + (z - paddedMin.Z);
+    };
+
+    // The Unreal increment vectors corresponding to moving by one voxel each in x,y,z
+    // in Triton coordinates
+    FVector cellIncrement = MapVoxelToPoint(FIntVector(1, 1, 1)) - MapVoxelToPoint(FIntVector(0, 0, 0));
+    FVector halfCellIncrement = cellIncrement * 0.5f;
+
+    //(x,y,z) enumerate over the voxel box oriented in Triton's coordinate system
+    for (int x = minVoxel.X; x < maxVoxel.X; x++)
+    {
+        for (int y = minVoxel.Y; y < maxVoxel.Y; y++)
+        {
+            for (int z = minVoxel.Z; z < maxVoxel.Z; z++)
+            {
+                // Draw faces only for occupied voxels
+                if (!occupied[occupiedIndex(x, y, z)])
+                {
+                    continue;
+                }
+
+                // The camera moves while the chunk stays cached, so consider both faces along each axis.
+                // Only render a face if it is on the surface -- that is, the voxel across it is air.
+                const FVector voxelCenter = MapVoxelToPoint(FIntVector(x, y, z));
+                for (int d = -1; d <= 1; d += 2)
+                {
+                    if (!occupied[occupiedIndex(x + d, y, z)])
+                    {
+                        auto faceCenter = voxelCenter;
+                        faceCenter.X += halfCellIncrement.X * d;
+                        AddAARectangle(chunk.Lines, faceCenter, voxelSize, AAFaceDirection::X, voxelColor);
+                    }
+
+                    if (!occupied[occupiedIndex(x, y + d, z)])
+                    {
+                        auto faceCenter = voxelCenter;
+                        faceCenter.Y += halfCellIncrement.Y * d;
+                        AddAARectangle(chunk.Lines, faceCenter, voxelSize, AAFaceDirection::Y, voxelColor);
+                    }
+
+                    if (!occupied[occupiedIndex(x, y, z + d)])
+                    {
+                        auto faceCenter = voxelCenter;
+                        faceCenter.Z += halfCellIncrement.Z * d;
+                        AddAARectangle(chunk.Lines, faceCenter, voxelSize, AAFaceDirection::Z, voxelColor);
+                    }
+                }
+            }
+        }
+    }
+}
+
 void AAcousticsDebugRenderer::RenderVoxels(
     const AcousticsSimulationConfiguration* config, FVector cameraPosition, FVector cameraDir, float cameraFOV)
 {
-    auto voxelColor = FColor::Green;
+    if (m_VoxelChunks.Num() == 0)
+    {
+        return;
+    }
+
     // Range in cm we should see the voxels.
     const auto visibleDistance = VoxelsDrawDistance;
 
-    DrawDebugBox(GetWorld(), m_VoxelMapBounds.GetCenter(), m_VoxelMapBounds.GetExtent(), voxelColor);
-
     const auto regionMinOffset = FVector(visibleDistance, visibleDistance, visibleDistance / 2);
     const auto regionMaxOffset = FVector(visibleDistance, visibleDistance, visibleDistance);
 
     // Voxel box center is slightly lower so we're closer to the ground
     auto regionCenter = cameraPosition - FVector(0, 0, 50.0f);
-    auto voxelSize = FVector(m_VoxelCellSize);
 
     FIntVector vox0 = MapPointToVoxel(regionCenter - regionMinOffset);
     FIntVector vox1 = MapPointToVoxel(regionCenter + regionMaxOffset);
-    FIntVector minVoxTriton(FMath::Min(vox0.X, vox1.X), FMath::Min(vox0.Y, vox1.Y), FMath::Min(vox0.Z, vox1.Z));
-    FIntVector maxVoxTriton(FMath::Max(vox0.X, vox1.X), FMath::Max(vox0.Y, vox1.Y), FMath::Max(vox0.Z, vox1.Z));
-
-    // Clamping to within distance of 1 to the edge because we consult neighboring
-    // voxels to determine if faces should be rendered - avoids out of bounds
-    // access into voxel map
-    minVoxTriton.X = FMath::Clamp<int>(minVoxTriton.X, 1, m_VoxelCounts.X - 1);
-    maxVoxTriton.X = FMath::Clamp<int>(maxVoxTriton.X, 1, m_VoxelCounts.X - 1);
-    minVoxTriton.Y = FMath::Clamp<int>(minVoxTriton.Y, 1, m_VoxelCounts.Y - 1);
-    maxVoxTriton.Y = FMath::Clamp<int>(maxVoxTriton.Y, 1, m_VoxelCounts.Y - 1);
-    minVoxTriton.Z = FMath::Clamp<int>(minVoxTriton.Z, 1, m_VoxelCounts.Z - 1);
-    maxVoxTriton.Z = FMath::Clamp<int>(maxVoxTriton.Z, 1, m_VoxelCounts.Z - 1);
-
-    auto centerOffset = m_VoxelCellSize * 0.5f;
-    auto startVoxelCenter = MapVoxelToPoint(minVoxTriton);
-    auto currentVoxelCenter = startVoxelCenter;
+    FIntVector minChunk(
+        FMath::Clamp(FMath::Min(vox0.X, vox1.X) / c_VoxelChunkSize, 0, m_VoxelChunkCounts.X - 1),
+        FMath::Clamp(FMath::Min(vox0.Y, vox1.Y) / c_VoxelChunkSize, 0, m_VoxelChunkCounts.Y - 1),
+        FMath::Clamp(FMath::Min(vox0.Z, vox1.Z) / c_VoxelChunkSize, 0, m_VoxelChunkCounts.Z - 1));
+    FIntVector maxChunk(
+        FMath::Clamp(FMath::Max(vox0.X, vox1.X) / c_VoxelChunkSize, 0, m_VoxelChunkCounts.X - 1),
+        FMath::Clamp(FMath::Max(vox0.Y, vox1.Y) / c_VoxelChunkSize, 0, m_VoxelChunkCounts.Y - 1),
+        FMath::Clamp(FMath::Max(vox0.Z, vox1.Z) / c_VoxelChunkSize, 0, m_VoxelChunkCounts.Z - 1));
 
     // Slightly larger than half-FOV so edge of conical culling region
     // doesn't become visible on screen corners
-    const float cullingAngle = 0.55f * cameraFOV;
-    const float cosHalfFrustumAngle = FMath::Cos(cullingAngle * PI / 180.0f);
-
-    // The Unreal increment vectors corresponding to moving by one voxel each in x,y,z
-    // in Triton coordinates
-    FVector cellIncrement = MapVoxelToPoint(FIntVector(1, 1, 1)) - MapVoxelToPoint(FIntVector(0, 0, 0));
-    FVector halfCellIncrement = cellIncrement * 0.5f;
+    const float cullingAngle = FMath::DegreesToRadians(0.55f * cameraFOV);
 
-    //(x,y,z) enumerate over the voxel box oriented in Triton's coordinate system
-    for (int x = minVoxTriton.X; x < maxVoxTriton.X; x++, currentVoxelCenter.X += cellIncrement.X)
+    // Chunks are visited in index order, so the list stays sorted for the comparison below
+    TArray<int32> visibleChunks;
+    for (int x = minChunk.X; x <= maxChunk.X; x++)
     {
-        for (int y = minVoxTriton.Y; y < maxVoxTriton.Y; y++, currentVoxelCenter.Y += cellIncrement.Y)
+        for (int y = minChunk.Y; y <= maxChunk.Y; y++)
         {
-            for (int z = minVoxTriton.Z; z < maxVoxTriton.Z; z++, currentVoxelCenter.Z += cellIncrement.Z)
+            for (int z = minChunk.Z; z <= maxChunk.Z; z++)
             {
-                auto cameraToVoxel = currentVoxelCenter - cameraPosition;
-                cameraToVoxel.Normalize();
-                auto viewFrustumDotProd = FVector::DotProduct(cameraToVoxel, cameraDir);
-
-                if (viewFrustumDotProd > 0.0f && viewFrustumDotProd > cosHalfFrustumAngle)
+                const int32 chunkIndex = (x * m_VoxelChunkCounts.Y + y) * m_VoxelChunkCounts.Z + z;
+
+                // Cone test against the chunk's bounding sphere
+                FVector chunkCenter, chunkExtent;
+                m_VoxelChunks[chunkIndex].Bounds.GetCenterAndExtents(chunkCenter, chunkExtent);
+                const float chunkRadius = chunkExtent.Size();
+                const FVector cameraToChunk = chunkCenter - cameraPosition;
+                const float distance = cameraToChunk.Size();
+                if (distance > chunkRadius)
                 {
-                    // Draw faces only for occupied voxels
-                    if (config->IsVoxelOccupied(x, y, z))
+                    const float cosAngle = FVector::DotProduct(cameraToChunk / distance, cameraDir);
+                    const float angle = FMath::Acos(FMath::Clamp(cosAngle, -1.0f, 1.0f));
+                    if (angle - FMath::Asin(chunkRadius / distance) > cullingAngle)
                     {
-                        // Only consider the 3 faces visible to camera. For each axis, we
-                        // have two faces pointing in opposite directions, each shared with a neighboring voxel.
-                        // So for each axis (X,Y,Z) figure out which of the two faces we want to render,
-                        // indicated by the signed direction (dx/dy/dz) to that neighbor for each axis
-                        int dx = (cameraToVoxel.X * cellIncrement.X > 0) ? -1 : 1;
-                        int dy = (cameraToVoxel.Y * cellIncrement.Y > 0) ? -1 : 1;
-                        int dz = (cameraToVoxel.Z * cellIncrement.Z > 0) ? -1 : 1;
-
-                        // For the three front faces, only render if the face is on the
-                        // surface -- that is, the voxel across it is air.
-
-                        // front-face in X
-                        if (!config->IsVoxelOccupied(x + dx, y, z))
-                        {
-                            auto faceCenter = currentVoxelCenter;
-                            faceCenter.X += halfCellIncrement.X * dx;
-                            DrawDebugAARectangle(GetWorld(), faceCenter, voxelSize, AAFaceDirection::X, voxelColor);
-                        }
-
-                        // front-face in Y
-                        if (!config->IsVoxelOccupied(x, y + dy, z))
-                        {
-                            auto faceCenter = currentVoxelCenter;
-                            faceCenter.Y += halfCellIncrement.Y * dy;
-                            DrawDebugAARectangle(GetWorld(), faceCenter, voxelSize, AAFaceDirection::Y, voxelColor);
-                        }
-
-                        // front-face in Z
-                        if (!config->IsVoxelOccupied(x, y, z + dz))
-                        {
-                            auto faceCenter = currentVoxelCenter;
-                            faceCenter.Z += halfCellIncrement.Z * dz;
-                            DrawDebugAARectangle(GetWorld(), faceCenter, voxelSize, AAFaceDirection::Z, voxelColor);
-                        }
+                        continue;
                     }
                 }
+                visibleChunks.Add(chunkIndex);
             }
-            currentVoxelCenter.Z = startVoxelCenter.Z;
         }
-        currentVoxelCenter.Y = startVoxelCenter.Y;
-        currentVoxelCenter.Z = startVoxelCenter.Z;
+    }
+
+    if (m_VoxelsShown && visibleChunks == m_VisibleVoxelChunks)
+    {
+        return;
+    }
+
+    m_VoxelLines->Flush();
+    m_VoxelLines->DrawLines(m_VoxelMapBoundsLines);
+    for (const int32 chunkIndex : visibleChunks)
+    {
+        if (!m_VoxelChunks[chunkIndex].IsBuilt)
+        {
+            BuildVoxelChunk(config, chunkIndex);
+        }
+        m_VoxelLines->DrawLines(m_VoxelChunks[chunkIndex].Lines);
+    }
+
+    m_VisibleVoxelChunks = MoveTemp(visibleChunks);
+    m_VoxelsShown = true;
+}
+
+void AAcousticsDebugRenderer::HideVoxels()
+{
+    if (m_VoxelsShown)
+    {
+        m_VoxelLines->Flush();
+        m_VisibleVoxelChunks.Reset();
+        m_VoxelsShown = false;
     }
 }
 
 // Normal needs to point in an axis-aligned direction. Undefined behavior otherwise.
-inline void AAcousticsDebugRenderer::DrawDebugAARectangle(
-    const UWorld* inWorld, const FVector& faceCenter, const FVector& faceSize, AAFaceDirection dir, const FColor& color)
+void AAcousticsDebugRenderer::AddAARectangle(
+    TArray<FBatchedLine>& lines, const FVector& faceCenter, const FVector& faceSize, AAFaceDirection dir,
+    const FColor& color) const
 {
     FVector offset = faceSize * 0.5f;
     FVector minCorner, dv1, dv2;
@@ -280,8 +498,9 @@ inline void AAcousticsDebugRenderer::DrawDebugAARectangle(
     FVector corner2 = minCorner + dv1 + dv2;
     FVector corner3 = minCorner + dv2;
 
-    DrawDebugLine(inWorld, minCorner, corner1, color);
-    DrawDebugLine(inWorld, corner1, corner2, color);
-    DrawDebugLine(inWorld, corner2, corner3, color);
-    DrawDebugLine(inWorld, corner3, minCorner, color);
+    // Zero lifetime keeps the lines until the line batch is flushed
+    lines.Emplace(minCorner, corner1, color, 0.0f, 0.0f, SDPG_World);
+    lines.Emplace(corner1, corner2, color, 0.0f, 0.0f, SDPG_World);
+    lines.Emplace(corner2, corner3, color, 0.0f, 0.0f, SDPG_World);
+    lines.Emplace(corner3, minCorner, color, 0.0f, 0.0f, SDPG_World);
 }
\ No newline at end of file
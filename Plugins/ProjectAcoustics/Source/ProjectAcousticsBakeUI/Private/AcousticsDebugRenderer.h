@@ -4,6 +4,8 @@
 #include "Classes/GameFramework/Actor.h"
 #include "Runtime/Engine/Classes/Engine/World.h"
 #include "Runtime/Engine/Public/DrawDebugHelpers.h"
+#include "Components/LineBatchComponent.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
 #include "AcousticsSimulationConfiguration.h"
 #include "AcousticsDebugRenderer.generated.h"
 
@@ -14,6 +16,14 @@ enum class AAFaceDirection
     Z
 };
 
+// Surface faces of a cubic block of voxels, built the first time the block comes into view
+struct AcousticsVoxelChunk
+{
+    FBox Bounds;
+    TArray<FBatchedLine> Lines;
+    bool IsBuilt = false;
+};
+
 UCLASS(config = Engine, hidecategories = Auto, BlueprintType, Blueprintable, ClassGroup = ProjectAcoustics)
 class AAcousticsDebugRenderer : public AActor
 {
@@ -34,29 +44,55 @@ public:
     virtual bool ShouldTickIfViewportsOnly() const override;
     virtual void Tick(float deltaSeconds) override;
     virtual void BeginPlay() override;
+#if WITH_EDITOR
+    virtual void PreSave(const class ITargetPlatform* TargetPlatform) override;
+#endif
 
 private:
+    // Probes and voxels are cached in components when a configuration becomes ready, so a frame only
+    // culls voxel chunks against the camera and re-submits lines when the visible set changes.
     void UpdateCacheAndRender(FVector cameraPosition, FVector cameraDir, float cameraFOV);
-    void RenderProbes();
+    void ClearCache();
+    void BuildProbeInstances();
+    void InitVoxelChunks();
+    void BuildVoxelChunk(const AcousticsSimulationConfiguration* config, int32 chunkIndex);
     void RenderVoxels(
         const AcousticsSimulationConfiguration* config, FVector cameraPosition, FVector cameraDir, float cameraFOV);
+    void HideVoxels();
 
-    void DrawDebugAARectangle(
-        const UWorld* inWorld, const FVector& faceCenter, const FVector& faceSize, AAFaceDirection dir,
-        const FColor& color);
+    void AddAARectangle(
+        TArray<FBatchedLine>& lines, const FVector& faceCenter, const FVector& faceSize, AAFaceDirection dir,
+        const FColor& color) const;
 
     FIntVector MapPointToVoxel(const FVector& point) const;
     FVector MapVoxelToPoint(const FIntVector& voxel) const;
 
 private:
     TSharedPtr<AcousticsSimulationConfiguration> m_Config;
+    // Set with the config, the cache is reset on the game thread
+    bool m_ConfigChanged;
     FCriticalSection m_Lock;
     TArray<FVector> m_ProbeLocations;
     TArray<float> m_ProbeDepths;
     TArray<float> m_ProbeHeights;
+    bool m_ProbesCached;
     bool m_VoxelInfoCached;
     FBox m_VoxelMapBounds;
     FBox m_VoxelMapBoundsTriton;
     FIntVector m_VoxelCounts;
     float m_VoxelCellSize;
+
+    // Chunks of the voxel map, indexed x-major like the voxels, and the ones currently submitted
+    TArray<AcousticsVoxelChunk> m_VoxelChunks;
+    FIntVector m_VoxelChunkCounts;
+    TArray<int32> m_VisibleVoxelChunks;
+    TArray<FBatchedLine> m_VoxelMapBoundsLines;
+    bool m_VoxelsShown;
+
+    // The renderer is saved with the level, so the cached geometry is cleared before saving and hidden in game
+    UPROPERTY(Transient)
+    UHierarchicalInstancedStaticMeshComponent* m_ProbeInstances;
+
+    UPROPERTY(Transient)
+    ULineBatchComponent* m_VoxelLines;
 };
@@ -6,6 +6,8 @@
 #include "Runtime/Launch/Resources/Version.h"
 #include "AcousticsEdModeToolkit.h"
 #include "AcousticsEditActions.h"
+#include "AcousticsGeometryExtraction.h"
+#include "Editor.h"
 #include "Toolkits/ToolkitManager.h"
 #include "EditorModeManager.h"
 #include "EngineUtils.h"
@@ -51,6 +53,8 @@ void FAcousticsEdMode::Enter()
         Toolkit = MakeShareable(new FAcousticsEdModeToolkit);
         Toolkit->Init(Owner->GetToolkitHost());
     }
+
+    m_MapChangeHandle = FEditorDelegates::MapChange.AddRaw(this, &FAcousticsEdMode::OnMapChange);
 }
 
 void FAcousticsEdMode::Exit()
@@ -61,10 +65,24 @@ void FAcousticsEdMode::Exit()
         Toolkit.Reset();
     }
 
+    FEditorDelegates::MapChange.Remove(m_MapChangeHandle);
+    m_MapChangeHandle.Reset();
+    // Prebake geometry is only reused while the mode stays open
+    AcousticsGeometryExtraction::ClearMeshCache();
+
     // Call base Exit method to ensure proper cleanup
     FEdMode::Exit();
 }
 
+void FAcousticsEdMode::OnMapChange(uint32 changeType)
+{
+    // Geometry cached for the previous level would never be hit again
+    if (changeType == MapChangeEventFlags::NewMap)
+    {
+        AcousticsGeometryExtraction::ClearMeshCache();
+    }
+}
+
 bool FAcousticsEdMode::UsesToolkits() const
 {
     return true;
@@ -180,10 +198,13 @@ bool FAcousticsEdMode::TagGeometry(bool tag)
                              "supported. Skipping tag."),
                         *c_AcousticsGeometryTag.ToString(),
                         *(actor->GetName()));
+                    // The tag may have been removed above
+                    m_OnActorTagsChanged.Broadcast(actor);
                     continue;
                 }
                 actor->Tags.Add(c_AcousticsGeometryTag);
             }
+            m_OnActorTagsChanged.Broadcast(actor);
         }
     }
 
@@ -205,6 +226,7 @@ bool FAcousticsEdMode::TagNavigation(bool tag)
             {
                 actor->Tags.Add(c_AcousticsNavigationTag);
             }
+            m_OnActorTagsChanged.Broadcast(actor);
         }
     }
 
@@ -0,0 +1,705 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "AcousticsGeometryExtraction.h"
+#include "AcousticsEdMode.h"
+#include "MathUtils.h"
+#include "StaticMeshResources.h"
+#include "Async/ParallelFor.h"
+#include "Algo/Sort.h"
+#include "Hash/CityHash.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+#include "Templates/Atomic.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+using namespace TritonRuntime;
+
+// Volumes are few and large, so leaves can hold a couple of them
+static const int32 c_MaxVolumesPerBvhLeaf = 2;
+
+static uint64 HashBytes(const void* data, int32 size, uint64 hash)
+{
+    return CityHash64WithSeed(static_cast<const char*>(data), size, hash);
+}
+
+static uint64 HashBox(const FBox& box, uint64 hash)
+{
+    const float values[] = {box.Min.X, box.Min.Y, box.Min.Z, box.Max.X, box.Max.Y, box.Max.Z};
+    return HashBytes(values, sizeof(values), hash);
+}
+
+// For meshes without a render data key, which are rebuilt for every prebake
+static uint64 HashRenderData(const FStaticMeshLODResources& renderData, uint64 hash)
+{
+#if ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION < 20
+    const auto& vertexBuffer = renderData.PositionVertexBuffer;
+#else
+    const auto& vertexBuffer = renderData.VertexBuffers.PositionVertexBuffer;
+#endif
+    TArray<FVector> positions;
+    positions.SetNumUninitialized(vertexBuffer.GetNumVertices());
+    for (int32 i = 0; i < positions.Num(); ++i)
+    {
+        positions[i] = vertexBuffer.VertexPosition(i);
+    }
+    hash = HashBytes(positions.GetData(), positions.Num() * sizeof(FVector), hash);
+
+    TArray<uint32> indices;
+    renderData.IndexBuffer.GetCopy(indices);
+    hash = HashBytes(indices.GetData(), indices.Num() * sizeof(uint32), hash);
+
+    for (const auto& section : renderData.Sections)
+    {
+        hash = HashBytes(&section.NumTriangles, sizeof(section.NumTriangles), hash);
+    }
+    return hash;
+}
+
+static bool IsOverlapped(const FBox& bounds, const FVector& vertex1, const FVector& vertex2, const FVector& vertex3)
+{
+    return bounds.IsInsideOrOn(vertex1) || bounds.IsInsideOrOn(vertex2) || bounds.IsInsideOrOn(vertex3);
+}
+
+void AcousticsVolumeBvh::Build(const TArray<AcousticsMaterialVolume>& volumes)
+{
+    m_Nodes.Reset();
+    m_VolumeIndices.Reset();
+    m_VolumeBounds.Reset();
+
+    for (int32 i = 0; i < volumes.Num(); ++i)
+    {
+        m_VolumeBounds.Add(volumes[i].Bounds);
+        m_VolumeIndices.Add(i);
+    }
+
+    if (volumes.Num() > 0)
+    {
+        BuildNode(0, volumes.Num());
+    }
+}
+
+int32 AcousticsVolumeBvh::BuildNode(int32 first, int32 count)
+{
+    FBox bounds(ForceInit);
+    FBox centers(ForceInit);
+    int32 minVolumeIndex = MAX_int32;
+    for (int32 i = first; i < first + count; ++i)
+    {
+        const int32 volumeIndex = m_VolumeIndices[i];
+        bounds += m_VolumeBounds[volumeIndex];
+        centers += m_VolumeBounds[volumeIndex].GetCenter();
+        minVolumeIndex = FMath::Min(minVolumeIndex, volumeIndex);
+    }
+
+    const int32 nodeIndex = m_Nodes.AddDefaulted();
+    m_Nodes[nodeIndex].Bounds = bounds;
+    m_Nodes[nodeIndex].MinVolumeIndex = minVolumeIndex;
+    m_Nodes[nodeIndex].Left = INDEX_NONE;
+    m_Nodes[nodeIndex].Right = INDEX_NONE;
+    m_Nodes[nodeIndex].FirstVolume = first;
+    m_Nodes[nodeIndex].VolumeCount = count;
+
+    if (count <= c_MaxVolumesPerBvhLeaf)
+    {
+        return nodeIndex;
+    }
+
+    // Split at the median along the longest axis of the volume centers
+    const FVector extent = centers.GetExtent();
+    const int32 axis = (extent.X >= extent.Y && extent.X >= extent.Z) ? 0 : (extent.Y >= extent.Z ? 1 : 2);
+    Algo::Sort(MakeArrayView(m_VolumeIndices.GetData() + first, count), [this, axis](int32 a, int32 b) {
+        return m_VolumeBounds[a].GetCenter()[axis] < m_VolumeBounds[b].GetCenter()[axis];
+    });
+
+    const int32 leftCount = count / 2;
+    const int32 left = BuildNode(first, leftCount);
+    const int32 right = BuildNode(first + leftCount, count - leftCount);
+
+    // Children were added after this node, so index again instead of holding a reference
+    m_Nodes[nodeIndex].Left = left;
+    m_Nodes[nodeIndex].Right = right;
+    m_Nodes[nodeIndex].VolumeCount = 0;
+    return nodeIndex;
+}
+
+bool AcousticsVolumeBvh::Overlaps(const FBox& bounds) const
+{
+    if (m_Nodes.Num() == 0)
+    {
+        return false;
+    }
+
+    TArray<int32, TInlineAllocator<32>> stack;
+    stack.Add(0);
+    while (stack.Num() > 0)
+    {
+        const Node& node = m_Nodes[stack.Pop(false)];
+        if (!node.Bounds.Intersect(bounds))
+        {
+            continue;
+        }
+
+        if (node.VolumeCount == 0)
+        {
+            stack.Add(node.Left);
+            stack.Add(node.Right);
+            continue;
+        }
+
+        for (int32 i = node.FirstVolume; i < node.FirstVolume + node.VolumeCount; ++i)
+        {
+            if (m_VolumeBounds[m_VolumeIndices[i]].Intersect(bounds))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void AcousticsVolumeBvh::GetOverlapping(const FBox& bounds, TArray<int32>& outVolumeIndices) const
+{
+    outVolumeIndices.Reset();
+    if (m_Nodes.Num() == 0)
+    {
+        return;
+    }
+
+    TArray<int32, TInlineAllocator<32>> stack;
+    stack.Add(0);
+    while (stack.Num() > 0)
+    {
+        const Node& node = m_Nodes[stack.Pop(false)];
+        if (!node.Bounds.Intersect(bounds))
+        {
+            continue;
+        }
+
+        if (node.VolumeCount == 0)
+        {
+            stack.Add(node.Left);
+            stack.Add(node.Right);
+            continue;
+        }
+
+        for (int32 i = node.FirstVolume; i < node.FirstVolume + node.VolumeCount; ++i)
+        {
+            if (m_VolumeBounds[m_VolumeIndices[i]].Intersect(bounds))
+            {
+                outVolumeIndices.Add(m_VolumeIndices[i]);
+            }
+        }
+    }
+    outVolumeIndices.Sort();
+}
+
+int32 AcousticsVolumeBvh::FindFirstContaining(const FVector& vertex1, const FVector& vertex2, const FVector& vertex3) const
+{
+    if (m_Nodes.Num() == 0)
+    {
+        return INDEX_NONE;
+    }
+
+    // A volume containing a vertex necessarily intersects the triangle's bounds
+    FBox triangleBounds(ForceInit);
+    triangleBounds += vertex1;
+    triangleBounds += vertex2;
+    triangleBounds += vertex3;
+
+    int32 best = INDEX_NONE;
+    TArray<int32, TInlineAllocator<32>> stack;
+    stack.Add(0);
+    while (stack.Num() > 0)
+    {
+        const Node& node = m_Nodes[stack.Pop(false)];
+        if ((best != INDEX_NONE && node.MinVolumeIndex >= best) || !node.Bounds.Intersect(triangleBounds))
+        {
+            continue;
+        }
+
+        if (node.VolumeCount == 0)
+        {
+            stack.Add(node.Left);
+            stack.Add(node.Right);
+            continue;
+        }
+
+        for (int32 i = node.FirstVolume; i < node.FirstVolume + node.VolumeCount; ++i)
+        {
+            const int32 volumeIndex = m_VolumeIndices[i];
+            if ((best == INDEX_NONE || volumeIndex < best) &&
+                IsOverlapped(m_VolumeBounds[volumeIndex], vertex1, vertex2, vertex3))
+            {
+                best = volumeIndex;
+            }
+        }
+    }
+    return best;
+}
+
+bool AcousticsPrebakeManifest::Load(const FString& filepath, TArray<AcousticsPrebakeManifestEntry>& outEntries)
+{
+    outEntries.Reset();
+    TArray<FString> lines;
+    if (!FFileHelper::LoadFileToStringArray(lines, *filepath))
+    {
+        return false;
+    }
+
+    // One entry per line: hash, bounds min and max, name
+    for (const FString& line : lines)
+    {
+        TArray<FString> fields;
+        if (line.ParseIntoArrayWS(fields) < 8)
+        {
+            continue;
+        }
+
+        AcousticsPrebakeManifestEntry& entry = outEntries.AddDefaulted_GetRef();
+        entry.Hash = FCString::Strtoui64(*fields[0], nullptr, 16);
+        entry.Bounds = FBox(
+            FVector(FCString::Atof(*fields[1]), FCString::Atof(*fields[2]), FCString::Atof(*fields[3])),
+            FVector(FCString::Atof(*fields[4]), FCString::Atof(*fields[5]), FCString::Atof(*fields[6])));
+        entry.Name = fields[7];
+    }
+    return true;
+}
+
+bool AcousticsPrebakeManifest::Save(const FString& filepath, const TArray<AcousticsPrebakeManifestEntry>& entries)
+{
+    TArray<FString> lines;
+    lines.Reserve(entries.Num());
+    for (const auto& entry : entries)
+    {
+        lines.Add(FString::Printf(
+            TEXT("%016llx %f %f %f %f %f %f %s"),
+            entry.Hash,
+            entry.Bounds.Min.X,
+            entry.Bounds.Min.Y,
+            entry.Bounds.Min.Z,
+            entry.Bounds.Max.X,
+            entry.Bounds.Max.Y,
+            entry.Bounds.Max.Z,
+            *entry.Name));
+    }
+    return FFileHelper::SaveStringArrayToFile(lines, *filepath);
+}
+
+FBox AcousticsPrebakeManifest::FindChangedRegion(
+    const TArray<AcousticsPrebakeManifestEntry>& previous, const TArray<AcousticsPrebakeManifestEntry>& current,
+    int32& outChangedCount)
+{
+    FBox region(ForceInit);
+    outChangedCount = 0;
+
+    // Entries of one list without a match in the other, counting duplicates (the same mesh placed twice at the
+    // same spot) one for one
+    auto addUnmatched = [&region, &outChangedCount](
+                            const TArray<AcousticsPrebakeManifestEntry>& entries,
+                            const TArray<AcousticsPrebakeManifestEntry>& others) {
+        TMap<uint64, int32> otherCounts;
+        for (const auto& other : others)
+        {
+            ++otherCounts.FindOrAdd(other.Hash);
+        }
+        for (const auto& entry : entries)
+        {
+            int32* count = otherCounts.Find(entry.Hash);
+            if (count && *count > 0)
+            {
+                --*count;
+                continue;
+            }
+            region += entry.Bounds;
+            ++outChangedCount;
+        }
+    };
+
+    // Removed or changed before, then added or changed now
+    addUnmatched(previous, current);
+    addUnmatched(current, previous);
+    return region;
+}
+
+TMap<AcousticsMeshCacheKey, TSharedPtr<AcousticsCachedMesh>> AcousticsGeometryExtraction::m_MeshCache;
+TMap<uint64, TSharedPtr<const AcousticsExtractedMesh>> AcousticsGeometryExtraction::m_ExtractedMeshCache;
+FCriticalSection AcousticsGeometryExtraction::m_ExtractedMeshCacheLock;
+
+void AcousticsGeometryExtraction::ClearMeshCache()
+{
+    check(IsInGameThread());
+    m_MeshCache.Empty();
+
+    FScopeLock lock(&m_ExtractedMeshCacheLock);
+    m_ExtractedMeshCache.Empty();
+}
+
+void AcousticsGeometryExtraction::HashJobs(
+    const TArray<AcousticsMeshExtractionJob>& jobs, const TArray<AcousticsMaterialVolume>& overrideVolumes,
+    const TArray<AcousticsMaterialVolume>& remapVolumes, TArray<uint64>& outHashes)
+{
+    outHashes.Reset();
+    outHashes.SetNumZeroed(jobs.Num());
+
+    AcousticsVolumeBvh overrideBvh;
+    overrideBvh.Build(overrideVolumes);
+    AcousticsVolumeBvh remapBvh;
+    remapBvh.Build(remapVolumes);
+
+    // Meshes without a render data key are hashed by content, which reads all their vertices
+    ParallelFor(jobs.Num(), [&](int32 jobIndex) {
+        outHashes[jobIndex] = HashJob(jobs[jobIndex], overrideVolumes, remapVolumes, overrideBvh, remapBvh);
+    });
+}
+
+uint64 AcousticsGeometryExtraction::HashJob(
+    const AcousticsMeshExtractionJob& job, const TArray<AcousticsMaterialVolume>& overrideVolumes,
+    const TArray<AcousticsMaterialVolume>& remapVolumes, const AcousticsVolumeBvh& overrideBvh,
+    const AcousticsVolumeBvh& remapBvh)
+{
+    uint64 hash = 0;
+    if (!job.RenderDataKey.IsEmpty())
+    {
+        hash = HashBytes(*job.RenderDataKey, job.RenderDataKey.Len() * sizeof(TCHAR), hash);
+    }
+    else
+    {
+        hash = HashRenderData(*job.RenderData, hash);
+    }
+
+    const FVector translation = job.Transform.GetTranslation();
+    const FQuat rotation = job.Transform.GetRotation();
+    const FVector scale = job.Transform.GetScale3D();
+    const float transform[] = {
+        translation.X, translation.Y, translation.Z, rotation.X, rotation.Y, rotation.Z, rotation.W, scale.X, scale.Y,
+        scale.Z};
+    hash = HashBytes(transform, sizeof(transform), hash);
+
+    const int32 type = static_cast<int32>(job.Type);
+    hash = HashBytes(&type, sizeof(type), hash);
+    hash = HashBytes(&job.ProbeSpacing, sizeof(job.ProbeSpacing), hash);
+    hash = HashBytes(
+        job.SectionMaterialCodes.GetData(), job.SectionMaterialCodes.Num() * sizeof(TritonMaterialCode), hash);
+
+    if (job.Type != MeshTypeGeometry)
+    {
+        return hash;
+    }
+
+    // Only the volumes touching the mesh affect it. Their relative order decides which one applies, so they are
+    // hashed in list order; adding or removing a volume elsewhere leaves the hash alone.
+    TArray<int32> volumeIndices;
+    overrideBvh.GetOverlapping(job.Bounds, volumeIndices);
+    for (const int32 volumeIndex : volumeIndices)
+    {
+        const auto& volume = overrideVolumes[volumeIndex];
+        hash = HashBox(volume.Bounds, hash);
+        const TritonMaterialCode overrideCode = volume.HasOverrideCode ? volume.OverrideCode : TRITON_DEFAULT_WALL_CODE;
+        hash = HashBytes(&volume.HasOverrideCode, sizeof(volume.HasOverrideCode), hash);
+        hash = HashBytes(&overrideCode, sizeof(overrideCode), hash);
+    }
+
+    remapBvh.GetOverlapping(job.Bounds, volumeIndices);
+    for (const int32 volumeIndex : volumeIndices)
+    {
+        const auto& volume = remapVolumes[volumeIndex];
+        hash = HashBox(volume.Bounds, hash);
+
+        // Only the remapping of codes the mesh uses matters, triangles past the last section use the default code
+        auto hashRemappedCode = [&hash, &volume](TritonMaterialCode code) {
+            const TritonMaterialCode* remappedCode = volume.RemappedCodes.Find(code);
+            const TritonMaterialCode result = remappedCode ? *remappedCode : code;
+            hash = HashBytes(&result, sizeof(result), hash);
+        };
+        for (const auto code : job.SectionMaterialCodes)
+        {
+            hashRemappedCode(code);
+        }
+        hashRemappedCode(TRITON_DEFAULT_WALL_CODE);
+    }
+    return hash;
+}
+
+void AcousticsGeometryExtraction::ReadMeshes(
+    const TArray<AcousticsMeshExtractionJob>& jobs, const TArray<uint64>& jobHashes,
+    TArray<TSharedPtr<const AcousticsExtractedMesh>>& outMeshes, TArray<TSharedPtr<AcousticsCachedMesh>>& outJobMeshes)
+{
+    check(jobHashes.Num() == jobs.Num());
+    outMeshes.Reset();
+    outMeshes.SetNum(jobs.Num());
+    outJobMeshes.Reset();
+    outJobMeshes.SetNum(jobs.Num());
+
+    // Reuse the geometry of every job that hasn't changed since the last prebake
+    TArray<int32> jobsToPlace;
+    {
+        FScopeLock lock(&m_ExtractedMeshCacheLock);
+        for (int32 jobIndex = 0; jobIndex < jobs.Num(); ++jobIndex)
+        {
+            outMeshes[jobIndex] = m_ExtractedMeshCache.FindRef(jobHashes[jobIndex]);
+            if (!outMeshes[jobIndex].IsValid())
+            {
+                jobsToPlace.Add(jobIndex);
+            }
+        }
+    }
+
+    // Find the cached geometry of every job to place. Meshes seen for the first time are read once below,
+    // no matter how many times they are placed.
+    TMap<AcousticsMeshCacheKey, TSharedPtr<AcousticsCachedMesh>> usedMeshes;
+    TArray<int32> jobsToRead;
+    int32 cacheHits = 0;
+    for (const int32 jobIndex : jobsToPlace)
+    {
+        const auto& job = jobs[jobIndex];
+        if (job.RenderDataKey.IsEmpty())
+        {
+            // Not cacheable, read privately for this job
+            outJobMeshes[jobIndex] = MakeShared<AcousticsCachedMesh>();
+            jobsToRead.Add(jobIndex);
+            continue;
+        }
+
+        AcousticsMeshCacheKey key{job.RenderDataKey, job.SectionMaterialCodes};
+        if (const auto* usedMesh = usedMeshes.Find(key))
+        {
+            outJobMeshes[jobIndex] = *usedMesh;
+            continue;
+        }
+
+        TSharedPtr<AcousticsCachedMesh> cachedMesh = m_MeshCache.FindRef(key);
+        if (cachedMesh.IsValid())
+        {
+            ++cacheHits;
+        }
+        else
+        {
+            cachedMesh = MakeShared<AcousticsCachedMesh>();
+            jobsToRead.Add(jobIndex);
+        }
+        outJobMeshes[jobIndex] = cachedMesh;
+        usedMeshes.Add(MoveTemp(key), MoveTemp(cachedMesh));
+    }
+
+    ParallelFor(jobsToRead.Num(), [&](int32 readIndex) {
+        const auto& job = jobs[jobsToRead[readIndex]];
+        ReadMesh(*job.RenderData, job.SectionMaterialCodes, *outJobMeshes[jobsToRead[readIndex]]);
+    });
+
+    UE_LOG(
+        LogAcoustics,
+        Display,
+        TEXT("Prebake mesh cache: %d of %d meshes unchanged since the last prebake. Of the rest, %d unique meshes, %d "
+             "reused from previous prebakes, %d read."),
+        jobs.Num() - jobsToPlace.Num(),
+        jobs.Num(),
+        usedMeshes.Num(),
+        cacheHits,
+        jobsToRead.Num());
+
+    // Keep only what this level uses, so edited and removed meshes don't accumulate over the session.
+    // Unchanged placements keep their mesh too, the next edit may move one of them.
+    for (const auto& job : jobs)
+    {
+        if (job.RenderDataKey.IsEmpty())
+        {
+            continue;
+        }
+        AcousticsMeshCacheKey key{job.RenderDataKey, job.SectionMaterialCodes};
+        if (!usedMeshes.Contains(key))
+        {
+            if (const auto* cachedMesh = m_MeshCache.Find(key))
+            {
+                usedMeshes.Add(MoveTemp(key), *cachedMesh);
+            }
+        }
+    }
+    m_MeshCache = MoveTemp(usedMeshes);
+}
+
+bool AcousticsGeometryExtraction::PlaceMeshes(
+    const TArray<AcousticsMeshExtractionJob>& jobs, const TArray<uint64>& jobHashes,
+    const TArray<TSharedPtr<AcousticsCachedMesh>>& jobMeshes, const TArray<AcousticsMaterialVolume>& overrideVolumes,
+    const TArray<AcousticsMaterialVolume>& remapVolumes, TArray<TSharedPtr<const AcousticsExtractedMesh>>& outMeshes,
+    TFunctionRef<bool(float)> progressCallback)
+{
+    check(jobHashes.Num() == jobs.Num() && jobMeshes.Num() == jobs.Num() && outMeshes.Num() == jobs.Num());
+
+    AcousticsVolumeBvh overrideBvh;
+    overrideBvh.Build(overrideVolumes);
+    AcousticsVolumeBvh remapBvh;
+    remapBvh.Build(remapVolumes);
+
+    // Identical jobs (the same mesh placed twice at the same spot) are placed once
+    TMap<uint64, TSharedPtr<const AcousticsExtractedMesh>> usedExtractedMeshes;
+    TArray<int32> jobsToPlace;
+    TArray<TSharedPtr<AcousticsExtractedMesh>> placedMeshes;
+    for (int32 jobIndex = 0; jobIndex < jobs.Num(); ++jobIndex)
+    {
+        if (!outMeshes[jobIndex].IsValid())
+        {
+            if (const auto* usedMesh = usedExtractedMeshes.Find(jobHashes[jobIndex]))
+            {
+                outMeshes[jobIndex] = *usedMesh;
+                continue;
+            }
+            TSharedPtr<AcousticsExtractedMesh> placedMesh = MakeShared<AcousticsExtractedMesh>();
+            jobsToPlace.Add(jobIndex);
+            placedMeshes.Add(placedMesh);
+            outMeshes[jobIndex] = placedMesh;
+        }
+        usedExtractedMeshes.Add(jobHashes[jobIndex], outMeshes[jobIndex]);
+    }
+
+    // Jobs vary wildly in size (a landscape vs. a crate), so let the task graph balance them one at a time
+    TAtomic<int32> placedCount(0);
+    TAtomic<bool> cancelled(false);
+    ParallelFor(jobsToPlace.Num(), [&](int32 placeIndex) {
+        // Jobs can't be taken back from the task graph, skip the remaining ones instead
+        if (cancelled)
+        {
+            return;
+        }
+
+        const int32 jobIndex = jobsToPlace[placeIndex];
+        PlaceMesh(
+            jobs[jobIndex],
+            *jobMeshes[jobIndex],
+            overrideVolumes,
+            remapVolumes,
+            overrideBvh,
+            remapBvh,
+            *placedMeshes[placeIndex]);
+
+        if (progressCallback(static_cast<float>(++placedCount) / jobsToPlace.Num()))
+        {
+            cancelled = true;
+        }
+    });
+
+    if (cancelled)
+    {
+        return false;
+    }
+
+    FScopeLock lock(&m_ExtractedMeshCacheLock);
+    m_ExtractedMeshCache = MoveTemp(usedExtractedMeshes);
+    return true;
+}
+
+void AcousticsGeometryExtraction::ReadMesh(
+    const FStaticMeshLODResources& renderData, const TArray<TritonMaterialCode>& sectionMaterialCodes,
+    AcousticsCachedMesh& outMesh)
+{
+#if ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION < 20
+    const auto& vertexBuffer = renderData.PositionVertexBuffer;
+#else
+    const auto& vertexBuffer = renderData.VertexBuffers.PositionVertexBuffer;
+#endif
+    auto indexBuffer = renderData.IndexBuffer.GetArrayView();
+    const int32 triangleCount = renderData.GetNumTriangles();
+    const int32 vertexCount = vertexBuffer.GetNumVertices();
+
+    outMesh.Positions.SetNumUninitialized(vertexCount);
+    for (int32 i = 0; i < vertexCount; ++i)
+    {
+        outMesh.Positions[i] = vertexBuffer.VertexPosition(i);
+    }
+
+    outMesh.TriangleInfos.SetNumUninitialized(triangleCount);
+    int32 sectionIndex = 0;
+    int32 sectionEnd = renderData.Sections.Num() > 0 ? static_cast<int32>(renderData.Sections[0].NumTriangles) : 0;
+    for (int32 triangle = 0; triangle < triangleCount; ++triangle)
+    {
+        const uint32 index1 = indexBuffer[(triangle * 3) + 0];
+        const uint32 index2 = indexBuffer[(triangle * 3) + 1];
+        const uint32 index3 = indexBuffer[(triangle * 3) + 2];
+
+        auto& triangleInfo = outMesh.TriangleInfos[triangle];
+        triangleInfo.Indices = ATKVectorI{static_cast<int>(index1), static_cast<int>(index2), static_cast<int>(index3)};
+
+        // Sections are laid out one after another in the index buffer
+        while (triangle >= sectionEnd && sectionIndex < renderData.Sections.Num())
+        {
+            ++sectionIndex;
+            if (sectionIndex < renderData.Sections.Num())
+            {
+                sectionEnd += renderData.Sections[sectionIndex].NumTriangles;
+            }
+        }
+
+        // Metadata meshes like nav meshes ignore material, and have no section codes
+        triangleInfo.MaterialCode = sectionIndex < sectionMaterialCodes.Num() ? sectionMaterialCodes[sectionIndex]
+                                                                              : TRITON_DEFAULT_WALL_CODE;
+    }
+}
+
+void AcousticsGeometryExtraction::PlaceMesh(
+    const AcousticsMeshExtractionJob& job, const AcousticsCachedMesh& mesh,
+    const TArray<AcousticsMaterialVolume>& overrideVolumes, const TArray<AcousticsMaterialVolume>& remapVolumes,
+    const AcousticsVolumeBvh& overrideBvh, const AcousticsVolumeBvh& remapBvh, AcousticsExtractedMesh& outMesh)
+{
+    const int32 vertexCount = mesh.Positions.Num();
+
+    // Fold the Unreal to Triton conversion (scale and Y flip) into the placement, so each vertex is one
+    // vectorized matrix multiply
+    const FMatrix localToTriton =
+        job.Transform.ToMatrixWithScale() *
+        FScaleMatrix(FVector(c_UnrealToTritonScale, -c_UnrealToTritonScale, c_UnrealToTritonScale));
+    outMesh.Vertices.SetNumUninitialized(vertexCount);
+    for (int32 i = 0; i < vertexCount; ++i)
+    {
+        const VectorRegister position = VectorLoadFloat3_W1(&mesh.Positions[i].X);
+        VectorStoreFloat3(VectorTransformVector(position, &localToTriton), &outMesh.Vertices[i].x);
+    }
+
+    outMesh.TriangleInfos = mesh.TriangleInfos;
+
+    // Most meshes are nowhere near a material volume, skip the per-triangle tests for them entirely
+    const bool testOverride = job.Type == MeshTypeGeometry && overrideBvh.Overlaps(job.Bounds);
+    const bool testRemap = job.Type == MeshTypeGeometry && remapBvh.Overlaps(job.Bounds);
+    if (!testOverride && !testRemap)
+    {
+        return;
+    }
+
+    // Volumes are tested in world space
+    TArray<FVector> worldVertices;
+    worldVertices.SetNumUninitialized(vertexCount);
+    for (int32 i = 0; i < vertexCount; ++i)
+    {
+        worldVertices[i] = job.Transform.TransformPosition(mesh.Positions[i]);
+    }
+
+    for (auto& triangleInfo : outMesh.TriangleInfos)
+    {
+        const FVector& vertex1 = worldVertices[triangleInfo.Indices.x];
+        const FVector& vertex2 = worldVertices[triangleInfo.Indices.y];
+        const FVector& vertex3 = worldVertices[triangleInfo.Indices.z];
+        const TritonMaterialCode sectionCode = triangleInfo.MaterialCode;
+
+        // The first override volume touching the triangle applies
+        if (testOverride)
+        {
+            const int32 overrideIndex = overrideBvh.FindFirstContaining(vertex1, vertex2, vertex3);
+            if (overrideIndex != INDEX_NONE && overrideVolumes[overrideIndex].HasOverrideCode)
+            {
+                triangleInfo.MaterialCode = overrideVolumes[overrideIndex].OverrideCode;
+            }
+        }
+
+        // Remap volumes take precedence over override volumes. Only the first remap volume touching the triangle
+        // is used, and it remaps the mesh's own material.
+        if (testRemap)
+        {
+            const int32 remapIndex = remapBvh.FindFirstContaining(vertex1, vertex2, vertex3);
+            if (remapIndex != INDEX_NONE)
+            {
+                if (const TritonMaterialCode* remappedCode = remapVolumes[remapIndex].RemappedCodes.Find(sectionCode))
+                {
+                    triangleInfo.MaterialCode = *remappedCode;
+                }
+            }
+        }
+    }
+}
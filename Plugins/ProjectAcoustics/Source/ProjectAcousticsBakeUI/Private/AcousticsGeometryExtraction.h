@@ -0,0 +1,198 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+// Add include for non-unity build
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "TritonPreprocessorApi.h"
+
+struct FStaticMeshLODResources;
+
+// Copy of an AcousticsProbeVolume used to override or remap materials, taken on the editor thread
+// so extraction never touches the actor.
+struct AcousticsMaterialVolume
+{
+    FString Name;
+    FBox Bounds;
+    // Acoustic material name for override volumes
+    FString MaterialName;
+    // Acoustic material name -> remapped acoustic material name for remap volumes
+    TMap<FString, FString> MaterialRemapping;
+
+    // Resolved on the editor thread before extraction, see SAcousticsProbesTab::ResolveMaterialVolumeCodes
+    bool HasOverrideCode = false;
+    TritonMaterialCode OverrideCode = TRITON_DEFAULT_WALL_CODE;
+    // Mesh material code -> remapped material code, only for codes this volume remaps
+    TMap<TritonMaterialCode, TritonMaterialCode> RemappedCodes;
+};
+
+// One static mesh placement to add to the acoustic mesh, gathered on the editor thread.
+// Everything extraction needs is resolved up front, so jobs can run on any thread.
+struct AcousticsMeshExtractionJob
+{
+    FString Name;
+    // LOD 0 render data of the mesh. Must stay alive until extraction completes.
+    const FStaticMeshLODResources* RenderData;
+    // Derived data key of the mesh's render data, identifying its content across placements and edits.
+    // Empty for meshes that should not be cached.
+    FString RenderDataKey;
+    // Local to world transform. Identity when vertices are already in world space.
+    FTransform Transform;
+    // World space bounds, used to skip volume tests for meshes no volume touches
+    FBox Bounds;
+    // Material code of every render section, in section order
+    TArray<TritonMaterialCode> SectionMaterialCodes;
+    MeshType Type;
+    // Only used for MeshTypeProbeSpacingVolume
+    float ProbeSpacing;
+};
+
+// Result of extracting one job, ready to be passed to AcousticMesh
+struct AcousticsExtractedMesh
+{
+    TArray<ATKVectorF> Vertices;
+    TArray<TritonAcousticMeshTriangleInformation> TriangleInfos;
+};
+
+// Geometry of a mesh in local space with its own material codes, shared by every placement of the mesh
+struct AcousticsCachedMesh
+{
+    TArray<FVector> Positions;
+    TArray<TritonAcousticMeshTriangleInformation> TriangleInfos;
+};
+
+// Meshes are cached per content and per material assignment, since placements can override materials
+struct AcousticsMeshCacheKey
+{
+    FString RenderDataKey;
+    TArray<TritonMaterialCode> SectionMaterialCodes;
+
+    bool operator==(const AcousticsMeshCacheKey& other) const
+    {
+        return RenderDataKey == other.RenderDataKey && SectionMaterialCodes == other.SectionMaterialCodes;
+    }
+
+    friend uint32 GetTypeHash(const AcousticsMeshCacheKey& key)
+    {
+        uint32 hash = GetTypeHash(key.RenderDataKey);
+        for (const auto code : key.SectionMaterialCodes)
+        {
+            hash = HashCombine(hash, GetTypeHash(static_cast<uint64>(code)));
+        }
+        return hash;
+    }
+};
+
+// Bounding volume hierarchy over material volume bounds, so each triangle only tests
+// the volumes it can actually touch.
+class AcousticsVolumeBvh final
+{
+public:
+    void Build(const TArray<AcousticsMaterialVolume>& volumes);
+
+    // Does any volume intersect the bounds?
+    bool Overlaps(const FBox& bounds) const;
+
+    // Indices of all volumes intersecting the bounds, in ascending order
+    void GetOverlapping(const FBox& bounds, TArray<int32>& outVolumeIndices) const;
+
+    // Lowest index of a volume containing any of the vertices, or INDEX_NONE.
+    // Volumes are tested in list order when overlapping, so the lowest index is the one that applies.
+    int32 FindFirstContaining(const FVector& vertex1, const FVector& vertex2, const FVector& vertex3) const;
+
+private:
+    struct Node
+    {
+        FBox Bounds;
+        // Lowest volume index below this node, to skip subtrees that can't beat the current best
+        int32 MinVolumeIndex;
+        // Inner nodes only
+        int32 Left;
+        int32 Right;
+        // Leaves only, range of m_VolumeIndices. Zero for inner nodes.
+        int32 FirstVolume;
+        int32 VolumeCount;
+    };
+
+    int32 BuildNode(int32 first, int32 count);
+
+    TArray<Node> m_Nodes;
+    TArray<int32> m_VolumeIndices;
+    TArray<FBox> m_VolumeBounds;
+};
+
+// What a prebake extracted for one job, stored beside the vox and config files to find what changed next time
+struct AcousticsPrebakeManifestEntry
+{
+    uint64 Hash;
+    FBox Bounds;
+    FString Name;
+};
+
+class AcousticsPrebakeManifest final
+{
+public:
+    static bool Load(const FString& filepath, TArray<AcousticsPrebakeManifestEntry>& outEntries);
+    static bool Save(const FString& filepath, const TArray<AcousticsPrebakeManifestEntry>& entries);
+
+    // Bounds of everything added, edited, moved or removed between two prebakes
+    static FBox FindChangedRegion(
+        const TArray<AcousticsPrebakeManifestEntry>& previous, const TArray<AcousticsPrebakeManifestEntry>& current,
+        int32& outChangedCount);
+};
+
+class AcousticsGeometryExtraction final
+{
+public:
+    // Hashes everything the extracted geometry of each job depends on: mesh content, transform, materials
+    // and the material volumes touching it. Jobs with equal hashes extract to identical geometry.
+    static void HashJobs(
+        const TArray<AcousticsMeshExtractionJob>& jobs, const TArray<AcousticsMaterialVolume>& overrideVolumes,
+        const TArray<AcousticsMaterialVolume>& remapVolumes, TArray<uint64>& outHashes);
+
+    // First half of extraction, on the editor thread: finds the geometry of jobs unchanged since the last prebake
+    // in this editor session, and reads the render data of the others. Both outputs are indexed like Jobs.
+    // OutMeshes is set for unchanged jobs, OutJobMeshes holds the local space geometry of the rest.
+    // Meshes with a render data key are read once for all their placements.
+    // Nothing of the engine, including the jobs' render data, is needed after this.
+    static void ReadMeshes(
+        const TArray<AcousticsMeshExtractionJob>& jobs, const TArray<uint64>& jobHashes,
+        TArray<TSharedPtr<const AcousticsExtractedMesh>>& outMeshes,
+        TArray<TSharedPtr<AcousticsCachedMesh>>& outJobMeshes);
+
+    // Second half of extraction, on any thread: places the jobs that ReadMeshes had no geometry for, in parallel.
+    // The progress callback is called from worker threads with the fraction of jobs done, and returns true to cancel,
+    // in which case this returns false and OutMeshes is incomplete.
+    static bool PlaceMeshes(
+        const TArray<AcousticsMeshExtractionJob>& jobs, const TArray<uint64>& jobHashes,
+        const TArray<TSharedPtr<AcousticsCachedMesh>>& jobMeshes,
+        const TArray<AcousticsMaterialVolume>& overrideVolumes, const TArray<AcousticsMaterialVolume>& remapVolumes,
+        TArray<TSharedPtr<const AcousticsExtractedMesh>>& outMeshes, TFunctionRef<bool(float)> progressCallback);
+
+    // Releases the geometry kept between prebakes. Safe to call while a prebake is extracting.
+    static void ClearMeshCache();
+
+private:
+    static uint64 HashJob(
+        const AcousticsMeshExtractionJob& job, const TArray<AcousticsMaterialVolume>& overrideVolumes,
+        const TArray<AcousticsMaterialVolume>& remapVolumes, const AcousticsVolumeBvh& overrideBvh,
+        const AcousticsVolumeBvh& remapBvh);
+
+    // Reads the render data into local space geometry with per-triangle material codes
+    static void ReadMesh(
+        const FStaticMeshLODResources& renderData, const TArray<TritonMaterialCode>& sectionMaterialCodes,
+        AcousticsCachedMesh& outMesh);
+
+    // Transforms a mesh to the job's placement and applies material volumes
+    static void PlaceMesh(
+        const AcousticsMeshExtractionJob& job, const AcousticsCachedMesh& mesh,
+        const TArray<AcousticsMaterialVolume>& overrideVolumes, const TArray<AcousticsMaterialVolume>& remapVolumes,
+        const AcousticsVolumeBvh& overrideBvh, const AcousticsVolumeBvh& remapBvh, AcousticsExtractedMesh& outMesh);
+
+private:
+    static TMap<AcousticsMeshCacheKey, TSharedPtr<AcousticsCachedMesh>> m_MeshCache;
+    // Job hash -> extracted geometry from the last prebake. Only one prebake runs at a time, and ReadMeshes
+    // runs after the previous PlaceMeshes finished. The lock is only needed against ClearMeshCache.
+    static TMap<uint64, TSharedPtr<const AcousticsExtractedMesh>> m_ExtractedMeshCache;
+    static FCriticalSection m_ExtractedMeshCacheLock;
+};
@@ -20,6 +20,9 @@
 #include "EngineUtils.h"    // FActorIterator
 #include "GameFramework/Actor.h"
 #include "Engine/StaticMeshActor.h"
+#include "Engine/StaticMesh.h"
+#include "Components/ActorComponent.h"
+#include "Editor.h"
 #include "Misc/ConfigCacheIni.h"
 #include "EditorModeManager.h"
 #include "SourceControlHelpers.h"
@@ -46,6 +49,18 @@ void SAcousticsMaterialsTab::Construct(const FArguments& InArgs)
     UpdateUEMaterials();
     PublishMaterialLibrary();
 
+    GEngine->OnLevelActorAdded().AddSP(this, &SAcousticsMaterialsTab::UpdateActorMaterials);
+    GEngine->OnLevelActorDeleted().AddSP(this, &SAcousticsMaterialsTab::RemoveActorMaterials);
+    FCoreUObjectDelegates::OnObjectPropertyChanged.AddSP(this, &SAcousticsMaterialsTab::OnObjectPropertyChanged);
+    FEditorDelegates::MapChange.AddSP(this, &SAcousticsMaterialsTab::OnMapChange);
+    FWorldDelegates::LevelAddedToWorld.AddSP(this, &SAcousticsMaterialsTab::OnLevelChanged);
+    FWorldDelegates::LevelRemovedFromWorld.AddSP(this, &SAcousticsMaterialsTab::OnLevelChanged);
+    if (m_AcousticsEditMode != nullptr)
+    {
+        m_AcousticsEditMode->OnActorTagsChanged().AddSP(this, &SAcousticsMaterialsTab::UpdateActorMaterials);
+    }
+    GEditor->RegisterForUndo(this);
+
     auto helpTextTitle = TEXT("Step Two");
     auto helpText = TEXT("Assign acoustic properties to each scene material using the dropdown."
                          "Different materials can have a dramatic effect on the results of the bake. "
@@ -116,12 +131,9 @@ void SAcousticsMaterialsTab::AddNewUEMaterialWithMigrationSupport(UMaterialInter
     if (curMaterial != nullptr)
     {
         // Instead of using unique ids to avoid duplicates, I simply check if the material item is in the list.
-        for (const TSharedPtr<MaterialItem>& Item : m_Items)
+        if (m_ItemsByName.Contains(curMaterial->GetName()))
         {
-            if (Item->UEMaterialName == curMaterial->GetName())
-            {
-                return;
-            }
+            return;
         }
 
         // MIGRATION SUPPORT. We used to store material information in the material uasset
@@ -132,7 +144,7 @@ void SAcousticsMaterialsTab::AddNewUEMaterialWithMigrationSupport(UMaterialInter
         if (materialAssignment != nullptr && !materialAssignment->AssignedMaterialName.IsEmpty())
         {
             // Update the materials list view
-            m_Items.Add(MakeShared<MaterialItem>(MaterialItem(
+            AddMaterialItem(MakeShared<MaterialItem>(MaterialItem(
                 curMaterial->GetName(), materialAssignment->AssignedMaterialName, materialAssignment->Absorptivity)));
             curMaterial->RemoveUserDataOfClass(UAcousticsMaterialUserData::StaticClass());
             curMaterial->MarkPackageDirty();
@@ -160,6 +172,11 @@ void SAcousticsMaterialsTab::AddNewUEMaterialWithMigrationSupport(UMaterialInter
 
 void SAcousticsMaterialsTab::UpdateUEMaterials()
 {
+    if (!m_NeedsFullUpdate)
+    {
+        return;
+    }
+
     // Don't try to update if a pre-bake is running in the background - this will cause the UI to deadlock until it's
     // done.
     if (AcousticsSharedState::GetSimulationConfiguration() &&
@@ -168,102 +185,268 @@ void SAcousticsMaterialsTab::UpdateUEMaterials()
         return;
     }
 
-    UWorld* currentWorld = GEditor->GetEditorWorldContext().World();
+    m_NeedsFullUpdate = false;
+    m_Items.Reset();
+    m_ItemsByName.Reset();
+    m_ActorMaterials.Reset();
+    m_MaterialUseCounts.Reset();
 
-    m_Items.Empty();
+    // The default material is always listed, it holds a use no actor will release
     UMaterial* defaultMat = UMaterial::GetDefaultMaterial(MD_Surface);
-    AddNewUEMaterial(defaultMat->GetName());
+    AddMaterialUse(defaultMat->GetName(), nullptr);
 
-    for (FActorIterator ActorIter(currentWorld); ActorIter; ++ActorIter)
+    for (FActorIterator ActorIter(GEditor->GetEditorWorldContext().World()); ActorIter; ++ActorIter)
     {
-        AActor* curActor = *ActorIter;
+        UpdateActorMaterials(*ActorIter);
+    }
 
-        // TODO - Add toggle to show all materials
-        if (curActor == nullptr)
-        {
-            continue;
-        }
+    // If the listview has already been created, then force it to update.
+    if (m_ListView.Get() != nullptr)
+    {
+        m_ListView->RequestListRefresh();
+    }
+}
 
-        // Check for acoustic material override volumes here. They won't be tagged, but should always be included
-        if (curActor->IsA<AAcousticsProbeVolume>())
-        {
-            AAcousticsProbeVolume* volume = Cast<AAcousticsProbeVolume>(curActor);
-            if (volume->VolumeType == AcousticsVolumeType::MaterialOverride)
-            {
-                // Using the override material prefix.
-                AddNewUEMaterial((AAcousticsProbeVolume::OverrideMaterialNamePrefix + volume->MaterialName));
-            }
-            // Check for acoustic remap volumes. They won't be tagged, but should always be included.
-            // Add a material item for every remap defined in the volume.
-            else if (volume->VolumeType == AcousticsVolumeType::MaterialRemap)
-            {
-                for (const TPair<FString, FString>& Remap : volume->MaterialRemapping)
-                {
-                    // Using the remap material prefix.
-                    AddNewUEMaterial((AAcousticsProbeVolume::RemapMaterialNamePrefix + Remap.Value));
-                }
-            }
-        }
+void SAcousticsMaterialsTab::RequestFullUpdate()
+{
+    m_NeedsFullUpdate = true;
+    UpdateUEMaterials();
+}
 
-        if (!curActor->Tags.Contains(c_AcousticsGeometryTag))
+void SAcousticsMaterialsTab::UpdateActorMaterials(AActor* actor)
+{
+    // A pending full update will pick the actor up anyway
+    if (actor == nullptr || m_NeedsFullUpdate)
+    {
+        return;
+    }
+
+    // Same as UpdateUEMaterials, wait for the pre-bake and catch up with a full update
+    if (AcousticsSharedState::GetSimulationConfiguration() &&
+        AcousticsSharedState::GetSimulationConfiguration()->GetState() == SimulationConfigurationState::InProcess)
+    {
+        m_NeedsFullUpdate = true;
+        return;
+    }
+
+    TArray<TPair<FString, UMaterialInterface*>> materials;
+    // Ignore actors spawned in other worlds, e.g. while playing in editor
+    if (actor->GetWorld() == GEditor->GetEditorWorldContext().World() && !actor->IsPendingKillPending())
+    {
+        GatherActorMaterials(actor, materials);
+    }
+
+    TArray<FString> previousNames;
+    m_ActorMaterials.RemoveAndCopyValue(actor, previousNames);
+
+    // Add the new uses before releasing the previous ones, so materials the actor keeps are never removed
+    bool listChanged = false;
+    TArray<FString> names;
+    for (const TPair<FString, UMaterialInterface*>& material : materials)
+    {
+        if (!names.Contains(material.Key))
         {
-            continue;
+            names.Add(material.Key);
+            listChanged |= AddMaterialUse(material.Key, material.Value);
         }
+    }
+    for (const FString& name : previousNames)
+    {
+        listChanged |= RemoveMaterialUse(name);
+    }
 
-        if (curActor->IsA<AStaticMeshActor>())
-        {
-            TArray<UMaterialInterface*> materials;
+    if (names.Num() > 0)
+    {
+        m_ActorMaterials.Add(actor, MoveTemp(names));
+    }
 
-            if (curActor->IsA<AStaticMeshActor>())
-            {
-                const UStaticMeshComponent* curMeshComp = Cast<AStaticMeshActor>(curActor)->GetStaticMeshComponent();
+    if (listChanged && m_ListView.Get() != nullptr)
+    {
+        m_ListView->RequestListRefresh();
+    }
+}
 
-                if (curMeshComp == nullptr)
-                {
-                    continue;
-                }
+void SAcousticsMaterialsTab::RemoveActorMaterials(AActor* actor)
+{
+    TArray<FString> previousNames;
+    if (!m_ActorMaterials.RemoveAndCopyValue(actor, previousNames))
+    {
+        return;
+    }
 
-                // This gets the override materials or the original static mesh materials as appropriate.
-                materials = curMeshComp->GetMaterials();
-            }
+    bool listChanged = false;
+    for (const FString& name : previousNames)
+    {
+        listChanged |= RemoveMaterialUse(name);
+    }
 
-            for (UMaterialInterface* curMaterial : materials)
+    if (listChanged && m_ListView.Get() != nullptr)
+    {
+        m_ListView->RequestListRefresh();
+    }
+}
+
+void SAcousticsMaterialsTab::GatherActorMaterials(
+    AActor* actor, TArray<TPair<FString, UMaterialInterface*>>& outMaterials) const
+{
+    // Check for acoustic material override volumes here. They won't be tagged, but should always be included
+    if (actor->IsA<AAcousticsProbeVolume>())
+    {
+        AAcousticsProbeVolume* volume = Cast<AAcousticsProbeVolume>(actor);
+        if (volume->VolumeType == AcousticsVolumeType::MaterialOverride)
+        {
+            // Using the override material prefix.
+            outMaterials.Emplace(AAcousticsProbeVolume::OverrideMaterialNamePrefix + volume->MaterialName, nullptr);
+        }
+        // Check for acoustic remap volumes. They won't be tagged, but should always be included.
+        // Add a material item for every remap defined in the volume.
+        else if (volume->VolumeType == AcousticsVolumeType::MaterialRemap)
+        {
+            for (const TPair<FString, FString>& Remap : volume->MaterialRemapping)
             {
-                if (curMaterial != nullptr)
-                {
-                    AddNewUEMaterialWithMigrationSupport(curMaterial);
-                }
+                // Using the remap material prefix.
+                outMaterials.Emplace(AAcousticsProbeVolume::RemapMaterialNamePrefix + Remap.Value, nullptr);
             }
         }
-        else if (curActor->IsA<ALandscapeProxy>()) // ALandscape derives from ALandscapeProxy
+    }
+
+    // TODO - Add toggle to show all materials
+    if (!actor->Tags.Contains(c_AcousticsGeometryTag))
+    {
+        return;
+    }
+
+    if (actor->IsA<AStaticMeshActor>())
+    {
+        const UStaticMeshComponent* curMeshComp = Cast<AStaticMeshActor>(actor)->GetStaticMeshComponent();
+
+        if (curMeshComp == nullptr)
+        {
+            return;
+        }
+
+        // This gets the override materials or the original static mesh materials as appropriate.
+        for (UMaterialInterface* curMaterial : curMeshComp->GetMaterials())
         {
-            auto landscape = Cast<ALandscapeProxy>(curActor);
-            UMaterialInterface* curMaterial = landscape->GetLandscapeMaterial();
             if (curMaterial != nullptr)
             {
-                AddNewUEMaterialWithMigrationSupport(curMaterial);
+                outMaterials.Emplace(curMaterial->GetName(), curMaterial);
             }
         }
+    }
+    else if (actor->IsA<ALandscapeProxy>()) // ALandscape derives from ALandscapeProxy
+    {
+        UMaterialInterface* curMaterial = Cast<ALandscapeProxy>(actor)->GetLandscapeMaterial();
+        if (curMaterial != nullptr)
+        {
+            outMaterials.Emplace(curMaterial->GetName(), curMaterial);
+        }
+    }
 
-        // Ignore all other actor types
+    // Ignore all other actor types
+}
+
+bool SAcousticsMaterialsTab::AddMaterialUse(const FString& materialName, UMaterialInterface* material)
+{
+    int32& useCount = m_MaterialUseCounts.FindOrAdd(materialName);
+    if (useCount++ > 0)
+    {
+        return false;
     }
 
-    // If the listview has already been created, then force it to update.
-    if (m_ListView.Get() != nullptr)
+    if (material != nullptr)
+    {
+        AddNewUEMaterialWithMigrationSupport(material);
+    }
+    else
     {
-        m_ListView->RebuildList();
+        AddNewUEMaterial(materialName);
     }
+    return m_ItemsByName.Contains(materialName);
+}
+
+bool SAcousticsMaterialsTab::RemoveMaterialUse(const FString& materialName)
+{
+    int32* useCount = m_MaterialUseCounts.Find(materialName);
+    if (useCount == nullptr || --(*useCount) > 0)
+    {
+        return false;
+    }
+
+    m_MaterialUseCounts.Remove(materialName);
+
+    // Removal keeps the order of the remaining rows. Assignments are saved in the config file, so they come
+    // back if the material is used again.
+    TSharedPtr<MaterialItem> item;
+    if (m_ItemsByName.RemoveAndCopyValue(materialName, item))
+    {
+        m_Items.RemoveSingle(item);
+        return true;
+    }
+    return false;
+}
+
+void SAcousticsMaterialsTab::AddMaterialItem(TSharedPtr<MaterialItem>&& item)
+{
+    m_ItemsByName.Add(item->UEMaterialName, item);
+    m_Items.Add(MoveTemp(item));
+}
+
+void SAcousticsMaterialsTab::OnObjectPropertyChanged(UObject* object, FPropertyChangedEvent& event)
+{
+    // Skip the stream of changes sent while dragging
+    if (object == nullptr || event.ChangeType == EPropertyChangeType::Interactive)
+    {
+        return;
+    }
+
+    // Editing a static mesh asset can change the materials of every actor placing it
+    if (object->IsA<UStaticMesh>())
+    {
+        RequestFullUpdate();
+    }
+    // Tags, volume settings and landscape materials are actor properties. Meshes and override materials
+    // belong to the mesh component.
+    else if (object->IsA<AActor>())
+    {
+        UpdateActorMaterials(Cast<AActor>(object));
+    }
+    else if (object->IsA<UActorComponent>())
+    {
+        UpdateActorMaterials(Cast<UActorComponent>(object)->GetOwner());
+    }
+}
+
+void SAcousticsMaterialsTab::OnMapChange(uint32 changeType)
+{
+    RequestFullUpdate();
+}
+
+void SAcousticsMaterialsTab::OnLevelChanged(ULevel* level, UWorld* world)
+{
+    if (world == GEditor->GetEditorWorldContext().World())
+    {
+        RequestFullUpdate();
+    }
+}
+
+void SAcousticsMaterialsTab::PostUndo(bool bSuccess)
+{
+    // Undo can restore deleted actors, old tags and old materials without any of the events above
+    RequestFullUpdate();
+}
+
+void SAcousticsMaterialsTab::PostRedo(bool bSuccess)
+{
+    RequestFullUpdate();
 }
 
 // Instead of using unique ids to avoid duplicates, simply check if the material item has already been added.
 void SAcousticsMaterialsTab::AddNewUEMaterial(FString materialName)
 {
-    for (const TSharedPtr<MaterialItem>& Item : m_Items)
+    if (m_ItemsByName.Contains(materialName))
     {
-        if (Item->UEMaterialName == materialName)
-        {
-            return;
-        }
+        return;
     }
 
     {
@@ -285,7 +468,7 @@ void SAcousticsMaterialsTab::AddNewUEMaterial(FString materialName)
                     TCHAR_TO_ANSI(*(tritonInfoValues[0])),
                     tritonInfoValues[0].Len());
                 acousticMaterial.Absorptivity = FCString::Atof(*tritonInfoValues[1]);
-                m_Items.Add(MakeShared<MaterialItem>(
+                AddMaterialItem(MakeShared<MaterialItem>(
                     MaterialItem(materialName, acousticMaterial.Name, acousticMaterial.Absorptivity)));
             }
             else
@@ -318,7 +501,7 @@ void SAcousticsMaterialsTab::AddNewUEMaterial(FString materialName)
             // If the call to GuessMaterialInfoFromGeneralName fails, we just write an error to the log and skip it.
             if (knownMaterialsLibrary->GuessMaterialInfoFromGeneralName(materialName, acousticMaterial, materialCode))
             {
-                m_Items.Add(MakeShared<MaterialItem>(
+                AddMaterialItem(MakeShared<MaterialItem>(
                     MaterialItem(materialName, acousticMaterial.Name, acousticMaterial.Absorptivity)));
             }
             else
@@ -6,12 +6,16 @@
 #include "Runtime/Core/Public/Containers/Array.h"
 #include "FMaterialRow.h"
 #include "AcousticsMaterialLibrary.h"
+#include "EditorUndoClient.h"
 
 // Forward declaration used
 // instead of an include to avoid cyclical dependencies.
 class FAcousticsEdMode;
+class AActor;
+class ULevel;
+class UWorld;
 
-class SAcousticsMaterialsTab : public SCompoundWidget
+class SAcousticsMaterialsTab : public SCompoundWidget, public FEditorUndoClient
 {
 public:
     SLATE_BEGIN_ARGS(SAcousticsMaterialsTab)
@@ -23,8 +27,13 @@ public:
     void Construct(const FArguments& InArgs);
 
     void PublishMaterialLibrary();
+    // Rescans the level if the incremental updates below could not keep the list current, otherwise does nothing
     void UpdateUEMaterials();
 
+    // FEditorUndoClient interface
+    virtual void PostUndo(bool bSuccess) override;
+    virtual void PostRedo(bool bSuccess) override;
+
     static FName ColumnNameMaterial;
     static FName ColumnNameAcoustics;
     static FName ColumnNameAbsorption;
@@ -41,12 +50,35 @@ private:
     void OnRowSelectionChanged(TSharedPtr<MaterialItem> InItem, ESelectInfo::Type SelectInfo);
     void AddNewUEMaterial(FString materialName);
     void AddNewUEMaterialWithMigrationSupport(UMaterialInterface* curMaterial);
+    void AddMaterialItem(TSharedPtr<MaterialItem>&& item);
     void InitKnownMaterialsList();
 
+    // Material tracking. The list holds the materials used by tagged geometry and material volumes, kept current
+    // by editor events so opening the tab never walks the level. Level loads, undo/redo and static mesh asset
+    // edits can change any actor and fall back to a full rescan.
+    void RequestFullUpdate();
+    void UpdateActorMaterials(AActor* actor);
+    void RemoveActorMaterials(AActor* actor);
+    // UE material names used by the actor, with the material when there is one (material volumes have none)
+    void GatherActorMaterials(AActor* actor, TArray<TPair<FString, UMaterialInterface*>>& outMaterials) const;
+    // Both return whether the list changed
+    bool AddMaterialUse(const FString& materialName, UMaterialInterface* material);
+    bool RemoveMaterialUse(const FString& materialName);
+    void OnObjectPropertyChanged(UObject* object, struct FPropertyChangedEvent& event);
+    void OnMapChange(uint32 changeType);
+    void OnLevelChanged(ULevel* level, UWorld* world);
+
     TArray<TSharedPtr<TritonAcousticMaterial>> m_ComboboxMaterialsList;
     TArray<TritonAcousticMaterial> m_KnownMaterials;
     TArray<TritonMaterialCode> m_KnownMaterialCodes;
     TArray<TSharedPtr<MaterialItem>> m_Items;
+    // Listed items by UE material name, for constant time duplicate checks
+    TMap<FString, TSharedPtr<MaterialItem>> m_ItemsByName;
+    // UE material names used by each actor of the editor world, and how many actors use each name.
+    // Actors are only used as keys, and removed before they are destroyed.
+    TMap<const AActor*, TArray<FString>> m_ActorMaterials;
+    TMap<FString, int32> m_MaterialUseCounts;
+    bool m_NeedsFullUpdate = true;
     TSharedPtr<SListView<TSharedPtr<MaterialItem>>> m_ListView;
     FAcousticsEdMode* m_AcousticsEditMode;
 };
@@ -10,6 +10,7 @@
 #include "SlateOptMacros.h"
 
 #include "EditorModeManager.h"
+#include "Editor.h"
 #include "EngineUtils.h"
 #include "GameFramework/Actor.h"
 
@@ -26,6 +27,16 @@ void SAcousticsObjectsTab::Construct(const FArguments& InArgs, SAcousticsEdit* o
     FSlateFontInfo StandardFont = FEditorStyle::GetFontStyle(TEXT("PropertyWindow.NormalFont"));
     FMargin StandardPadding(6.f, 3.f);
 
+    RecountTaggedActors();
+    GEngine->OnLevelActorAdded().AddSP(this, &SAcousticsObjectsTab::UpdateTaggedActor);
+    GEngine->OnLevelActorDeleted().AddSP(this, &SAcousticsObjectsTab::OnLevelActorDeleted);
+    FCoreUObjectDelegates::OnObjectPropertyChanged.AddSP(this, &SAcousticsObjectsTab::OnObjectPropertyChanged);
+    FEditorDelegates::MapChange.AddSP(this, &SAcousticsObjectsTab::OnMapChange);
+    FWorldDelegates::LevelAddedToWorld.AddSP(this, &SAcousticsObjectsTab::OnLevelChanged);
+    FWorldDelegates::LevelRemovedFromWorld.AddSP(this, &SAcousticsObjectsTab::OnLevelChanged);
+    m_AcousticsEditMode->OnActorTagsChanged().AddSP(this, &SAcousticsObjectsTab::UpdateTaggedActor);
+    GEditor->RegisterForUndo(this);
+
     const FString helpTextTitle = TEXT("Step One");
     const FString helpText =
         TEXT("Select geometry and navigation objects in the scene that impact the acoustics simulation.");
@@ -291,7 +302,10 @@ void SAcousticsObjectsTab::Construct(const FArguments& InArgs, SAcousticsEdit* o
         [
             SNew(STextBlock)
             .AutoWrapText(true)
-            .Text_Lambda([this]() { return FText::FromString(m_NumGeo); })
+            .Text_Lambda([this]() {
+                return FText::FromString(
+                    FString::Printf(TEXT("Objects tagged for Geometry: %d"), m_GeometryActors.Num()));
+            })
         ]
 
         + SVerticalBox::Slot()
@@ -300,7 +314,10 @@ void SAcousticsObjectsTab::Construct(const FArguments& InArgs, SAcousticsEdit* o
         [
             SNew(STextBlock)
             .AutoWrapText(true)
-            .Text_Lambda([this]() { return FText::FromString(m_NumNav); })
+            .Text_Lambda([this]() {
+                return FText::FromString(
+                    FString::Printf(TEXT("Objects tagged for Navigation: %d"), m_NavigationActors.Num()));
+            })
         ]
     ];
     // clang-format on
@@ -308,28 +325,81 @@ void SAcousticsObjectsTab::Construct(const FArguments& InArgs, SAcousticsEdit* o
 
 END_SLATE_FUNCTION_BUILD_OPTIMIZATION
 
-void SAcousticsObjectsTab::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+void SAcousticsObjectsTab::RecountTaggedActors()
 {
-    // For the objects tab, every frame we should count up the number of tagged items and update our counts
-    // This is because users can change the tags outside of our UI. This method makes sure the displayed
-    // tagged counts are always accurate
-
-    int geo = 0;
-    int nav = 0;
+    m_GeometryActors.Reset();
+    m_NavigationActors.Reset();
     for (TActorIterator<AActor> ActorItr(GEditor->GetEditorWorldContext().World()); ActorItr; ++ActorItr)
     {
-        AActor* actor = *ActorItr;
-        if (actor->ActorHasTag(c_AcousticsGeometryTag))
-        {
-            geo += 1;
-        }
-        if (actor->ActorHasTag(c_AcousticsNavigationTag))
-        {
-            nav += 1;
-        }
+        UpdateTaggedActor(*ActorItr);
+    }
+}
+
+void SAcousticsObjectsTab::UpdateTaggedActor(AActor* actor)
+{
+    // Ignore actors spawned in other worlds, e.g. while playing in editor
+    if (actor == nullptr || actor->GetWorld() != GEditor->GetEditorWorldContext().World())
+    {
+        return;
+    }
+
+    if (actor->ActorHasTag(c_AcousticsGeometryTag))
+    {
+        m_GeometryActors.Add(actor);
+    }
+    else
+    {
+        m_GeometryActors.Remove(actor);
+    }
+
+    if (actor->ActorHasTag(c_AcousticsNavigationTag))
+    {
+        m_NavigationActors.Add(actor);
+    }
+    else
+    {
+        m_NavigationActors.Remove(actor);
+    }
+}
+
+void SAcousticsObjectsTab::OnLevelActorDeleted(AActor* actor)
+{
+    m_GeometryActors.Remove(actor);
+    m_NavigationActors.Remove(actor);
+}
+
+void SAcousticsObjectsTab::OnObjectPropertyChanged(UObject* object, FPropertyChangedEvent& event)
+{
+    // Tags edited in the details panel
+    if (event.GetPropertyName() == GET_MEMBER_NAME_CHECKED(AActor, Tags) ||
+        event.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(AActor, Tags))
+    {
+        UpdateTaggedActor(Cast<AActor>(object));
     }
-    m_NumGeo = FString::Printf(TEXT("Objects tagged for Geometry: %d"), geo);
-    m_NumNav = FString::Printf(TEXT("Objects tagged for Navigation: %d"), nav);
+}
+
+void SAcousticsObjectsTab::OnMapChange(uint32 changeType)
+{
+    RecountTaggedActors();
+}
+
+void SAcousticsObjectsTab::OnLevelChanged(ULevel* level, UWorld* world)
+{
+    if (world == GEditor->GetEditorWorldContext().World())
+    {
+        RecountTaggedActors();
+    }
+}
+
+void SAcousticsObjectsTab::PostUndo(bool bSuccess)
+{
+    // Undo can restore deleted actors and old tags without any of the events above
+    RecountTaggedActors();
+}
+
+void SAcousticsObjectsTab::PostRedo(bool bSuccess)
+{
+    RecountTaggedActors();
 }
 
 void SAcousticsObjectsTab::OnAcousticsRadioButtonChanged(ECheckBoxState inState)
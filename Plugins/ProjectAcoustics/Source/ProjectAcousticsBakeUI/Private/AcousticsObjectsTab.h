@@ -3,8 +3,9 @@
 #pragma once
 #include "SAcousticsEdit.h"
 #include "Widgets/SCompoundWidget.h"
+#include "EditorUndoClient.h"
 
-class SAcousticsObjectsTab : public SCompoundWidget
+class SAcousticsObjectsTab : public SCompoundWidget, public FEditorUndoClient
 {
 public:
     SLATE_BEGIN_ARGS(SAcousticsObjectsTab)
@@ -13,7 +14,10 @@ public:
     SLATE_END_ARGS()
 
     void Construct(const FArguments& InArgs, SAcousticsEdit* ownerEdit);
-    virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+
+    // FEditorUndoClient interface
+    virtual void PostUndo(bool bSuccess) override;
+    virtual void PostRedo(bool bSuccess) override;
 
 private:
     // Checkbox handlers
@@ -39,8 +43,18 @@ private:
     FReply OnClearTag();
     FReply OnSelectAllTag();
 
+    // Tagged actor tracking. Users can change tags outside of our UI, so the counts follow editor events
+    // instead of being recounted every frame. Only level loads and undo/redo need a full recount.
+    void RecountTaggedActors();
+    void UpdateTaggedActor(AActor* actor);
+    void OnLevelActorDeleted(AActor* actor);
+    void OnObjectPropertyChanged(UObject* object, struct FPropertyChangedEvent& event);
+    void OnMapChange(uint32 changeType);
+    void OnLevelChanged(ULevel* level, UWorld* world);
+
     FAcousticsEdMode* m_AcousticsEditMode;
     SAcousticsEdit* m_Owner;
-    FString m_NumNav;
-    FString m_NumGeo;
+    // Actors of the editor world carrying each tag. Only used as keys, removed before the actor is destroyed.
+    TSet<const AActor*> m_GeometryActors;
+    TSet<const AActor*> m_NavigationActors;
 };
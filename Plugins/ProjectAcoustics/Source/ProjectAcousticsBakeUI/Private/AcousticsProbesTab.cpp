@@ -26,6 +26,7 @@
 #include "Materials/Material.h"
 #include "HAL/PlatformFilemanager.h"
 #include "Misc/Char.h"
+#include "Misc/ScopeLock.h"
 #include "SlateOptMacros.h"
 #include "Widgets/Input/SButton.h"
 #include "EngineUtils.h"
@@ -126,7 +127,8 @@ CreateStaticMesh(FMeshDescription& RawMesh, TArray<FStaticMaterial>& Materials,
 
 using namespace TritonRuntime;
 
-bool SAcousticsProbesTab::m_CancelRequest = false;
+TAtomic<bool> SAcousticsProbesTab::m_CancelRequest(false);
+FCriticalSection SAcousticsProbesTab::m_StatusLock;
 FString SAcousticsProbesTab::m_CurrentStatus = TEXT("");
 float SAcousticsProbesTab::m_CurrentProgress = 0.0f;
 
@@ -157,6 +159,7 @@ void SAcousticsProbesTab::Construct(const FArguments& InArgs, SAcousticsEdit* ow
     FEditorDelegates::MapChange.AddLambda([](uint32 changeType) {
         if (changeType == MapChangeEventFlags::NewMap)
         {
+            FScopeLock lock(&m_StatusLock);
             m_CurrentStatus = TEXT("");
         }
     });
@@ -328,7 +331,7 @@ void SAcousticsProbesTab::Construct(const FArguments& InArgs, SAcousticsEdit* ow
         [
             SNew(STextBlock)
             .AutoWrapText(true)
-            .Text_Lambda([this]() { return FText::FromString(m_CurrentStatus); })
+            .Text_Lambda([this]() { return FText::FromString(GetCurrentStatus()); })
         ]
     ];
     // clang-format on
@@ -649,27 +652,8 @@ UStaticMesh* ExtractStaticMeshFromNavigationMesh(const ARecastNavMesh* navMeshAc
     return staticMesh;
 }
 
-TritonMaterialCode GetMaterialCodeForFace(
-    const UStaticMesh* mesh, const TArray<UMaterialInterface*>& materials, uint32 face,
-    TArray<uint32>& materialIDsNotFound)
+TritonMaterialCode GetMaterialCodeForSection(const UMaterialInterface* material, TArray<uint32>& materialIDsNotFound)
 {
-    UMaterialInterface* material = nullptr;
-    const auto& renderData = mesh->GetLODForExport(0);
-    auto sectionCount = renderData.Sections.Num();
-
-    auto totalTriangles = 0u;
-    for (const auto& section : renderData.Sections)
-    {
-        if (face >= totalTriangles && face < (totalTriangles + section.NumTriangles) &&
-            section.MaterialIndex < materials.Num())
-        {
-            // We've found the material for this face, so save it and move on.
-            material = materials[section.MaterialIndex];
-            break;
-        }
-        totalTriangles += section.NumTriangles;
-    }
-
     TritonMaterialCode code = TRITON_DEFAULT_WALL_CODE;
     if (material && AcousticsSharedState::GetMaterialsLibrary())
     {
@@ -690,23 +674,14 @@ TritonMaterialCode GetMaterialCodeForFace(
     return code;
 }
 
-void SAcousticsProbesTab::AddStaticMeshToAcousticMesh(
-    AcousticMesh* acousticMesh, AActor* actor, const UStaticMesh* mesh, const TArray<UMaterialInterface*>& materials,
-    MeshType type, TArray<uint32>& materialIDsNotFound)
+void SAcousticsProbesTab::GatherStaticMesh(
+    TArray<AcousticsMeshExtractionJob>& jobs, AActor* actor, const UStaticMesh* mesh,
+    const TArray<UMaterialInterface*>& materials, MeshType type, TArray<uint32>& materialIDsNotFound)
 {
-    TArray<ATKVectorF> vertices;
-    TArray<TritonAcousticMeshTriangleInformation> triangleInfos;
-
     if (mesh == nullptr)
     {
         return;
     }
-    // From the acoustics ed mode, get the pointer to the materials tab and get a read-only reference to the material
-    // items list.
-    FAcousticsEdMode* AcousticsEdMode =
-        static_cast<FAcousticsEdMode*>(GLevelEditorModeTools().GetActiveMode(FAcousticsEdMode::EM_AcousticsEdModeId));
-    const TArray<TSharedPtr<MaterialItem>>& MaterialItemsList =
-        AcousticsEdMode->GetMaterialsTab()->GetMaterialItemsList();
 
     const auto checkHasVerts = true;
     const auto LOD = 0;
@@ -718,154 +693,47 @@ void SAcousticsProbesTab::AddStaticMeshToAcousticMesh(
             TEXT("Error while adding static mesh [%s], there is no valid render data for LOD %d. Ignoring."),
             *mesh->GetName(),
             LOD);
+        return;
     }
 
-    const auto& renderData = mesh->GetLODForExport(LOD);
-#if ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION < 20
-    const auto& vertexBuffer = renderData.PositionVertexBuffer;
-#else
-    const auto& vertexBuffer = renderData.VertexBuffers.PositionVertexBuffer;
-#endif
-    auto indexBuffer = renderData.IndexBuffer.GetArrayView();
-    auto triangleCount = renderData.GetNumTriangles();
-    auto vertexCount = vertexBuffer.GetNumVertices();
-    for (auto i = 0u; i < vertexCount; ++i)
+    AcousticsMeshExtractionJob& job = jobs.AddDefaulted_GetRef();
+    job.Name = mesh->GetName();
+    job.RenderData = &mesh->GetLODForExport(LOD);
+    // If actor is provided, its actor-to-world transform is used,
+    // otherwise vertices are interpreted to be directly in world coordinates
+    job.Transform = actor == nullptr ? FTransform::Identity : actor->GetTransform();
+    job.Bounds = mesh->GetBounds().GetBox().TransformBy(job.Transform);
+
+    // Meshes created just for this prebake (landscapes, volumes, nav meshes) are not worth caching
+    if (mesh->RenderData.IsValid() && mesh->GetOutermost() != GetTransientPackage())
     {
-        // If actor is provided, its actor-to-world transform is used,
-        // otherwise vertices are interpreted to be directly in world coordinates
-        const auto& vertexPos = vertexBuffer.VertexPosition(i);
-        const auto& vertexWorld = actor == nullptr ? vertexPos : actor->GetTransform().TransformPosition(vertexPos);
-        auto vertex = UnrealPositionToTriton(vertexWorld);
-        vertices.Add(ATKVectorF{vertex.X, vertex.Y, vertex.Z});
+        job.RenderDataKey = mesh->RenderData->DerivedDataKey;
     }
+    job.Type = type;
+    job.ProbeSpacing = 0.0f;
 
-    for (auto triangle = 0; triangle < triangleCount; ++triangle)
+    // Only lookup material codes for geometry meshes. Resolving once per section here keeps
+    // every UObject access on the editor thread.
+    if (type == MeshTypeGeometry)
     {
-        auto index1 = indexBuffer[(triangle * 3) + 0];
-        auto index2 = indexBuffer[(triangle * 3) + 1];
-        auto index3 = indexBuffer[(triangle * 3) + 2];
-
-        TritonAcousticMeshTriangleInformation triangleInfo;
-        triangleInfo.Indices = ATKVectorI{static_cast<int>(index1), static_cast<int>(index2), static_cast<int>(index3)};
-        // Only lookup material codes for geometry meshes.
-        if (type == MeshTypeGeometry)
+        for (const auto& section : job.RenderData->Sections)
         {
-            // Cache off the material code for this triangle.
-            TritonMaterialCode MaterialCode = GetMaterialCodeForFace(mesh, materials, triangle, materialIDsNotFound);
-
-            // If there are any material override volumes, check those first
-            bool useOverride = false;
-            for (auto i = 0; i < m_MaterialOverrideVolumes.Num(); i++)
-            {
-                // See if any of the triangle vertices is inside or on the override volume
-                // if any of them are, use this override value
-                AAcousticsProbeVolume* overrideVolume = m_MaterialOverrideVolumes[i];
-                if (IsOverlapped(overrideVolume, vertices[index1], vertices[index2], vertices[index3]))
-                {
-                    // Using the override material name prefix.
-                    if (!AcousticsSharedState::GetMaterialsLibrary()->FindMaterialCode(
-                            (AAcousticsProbeVolume::OverrideMaterialNamePrefix + overrideVolume->MaterialName),
-                            &triangleInfo.MaterialCode))
-                    {
-                        UE_LOG(
-                            LogAcoustics,
-                            Error,
-                            TEXT("The material %s has no acoustic material mapping (it did not show up in the "
-                                 "materials mapping tab), but is used by a mesh. Using the default code."),
-                            // Using the override material name prefix.
-                            *(AAcousticsProbeVolume::OverrideMaterialNamePrefix + overrideVolume->MaterialName));
-                    }
-
-                    useOverride = true;
-                    break;
-                }
-            }
-            // Implemented calculations for remap volumes.
-            bool useRemap = false;
-            // remap volumes calculations
-            for (int32 i = 0; i < m_MaterialRemapVolumes.Num(); ++i)
-            {
-                // See if any of the triangle vertices is inside or on the remap volume
-                // if any of them are, and the material is supposed to be remapped, do it
-                AAcousticsProbeVolume* remapVolume = m_MaterialRemapVolumes[i];
-                if (IsOverlapped(remapVolume, vertices[index1], vertices[index2], vertices[index3]))
-                {
-                    useRemap = true;
-
-                    TritonAcousticMaterial AcousticMaterial;
-                    if (!TritonPreprocessor_MaterialLibrary_GetMaterialInfo(
-                            AcousticsSharedState::GetMaterialsLibrary()->GetHandle(), MaterialCode, &AcousticMaterial))
-                    {
-                        useRemap = false;
-                        break;
-                    }
-
-                    FString acousticMaterialToRemap;
-                    for (const TSharedPtr<MaterialItem>& Item : MaterialItemsList)
-                    {
-                        if (Item->UEMaterialName == AcousticMaterial.Name)
-                        {
-                            acousticMaterialToRemap = Item->AcousticMaterialName;
-                            break;
-                        }
-                    }
-
-                    FString* RemappedMaterialName = remapVolume->MaterialRemapping.Find(acousticMaterialToRemap);
-                    if (RemappedMaterialName == nullptr)
-                    {
-                        useRemap = false;
-                        break;
-                    }
-
-                    FString RemappedAcousticMaterialName =
-                        AAcousticsProbeVolume::RemapMaterialNamePrefix + *RemappedMaterialName;
-
-                    if (!AcousticsSharedState::GetMaterialsLibrary()->FindMaterialCode(
-                            RemappedAcousticMaterialName, &triangleInfo.MaterialCode))
-                    {
-                        useRemap = false;
-                        UE_LOG(
-                            LogAcoustics,
-                            Error,
-                            TEXT("Invalid acoustic material %s found in the AcousticMaterialRemapping volume %s."),
-                            *RemappedAcousticMaterialName,
-                            *(remapVolume->GetName()));
-                    }
-
-                    break;
-                }
-            }
-            if (!useOverride && !useRemap)
-            {
-                triangleInfo.MaterialCode = MaterialCode;
-            }
-        }
-        else
-        {
-            // Metadata meshes like nav meshes will ignore material, provide default.
-            triangleInfo.MaterialCode = TRITON_DEFAULT_WALL_CODE;
+            const UMaterialInterface* material =
+                section.MaterialIndex < materials.Num() ? materials[section.MaterialIndex] : nullptr;
+            job.SectionMaterialCodes.Add(GetMaterialCodeForSection(material, materialIDsNotFound));
         }
-        triangleInfos.Add(triangleInfo);
     }
 
     if (type == MeshTypeProbeSpacingVolume)
     {
-        auto probeVol = dynamic_cast<AAcousticsProbeVolume*>(actor);
-        acousticMesh->AddProbeSpacingVolume(
-            vertices.GetData(),
-            vertices.Num(),
-            triangleInfos.GetData(),
-            triangleInfos.Num(),
-            probeVol->MaxProbeSpacing);
-    }
-    else
-    {
-        acousticMesh->Add(vertices.GetData(), vertices.Num(), triangleInfos.GetData(), triangleInfos.Num(), type);
+        auto probeVol = Cast<AAcousticsProbeVolume>(actor);
+        job.ProbeSpacing = probeVol->MaxProbeSpacing;
     }
 }
 
-void SAcousticsProbesTab::AddLandscapeToAcousticMesh(
-    AcousticMesh* acousticMesh, ALandscapeProxy* actor, MeshType type, TArray<uint32>& materialIDsNotFound)
+void SAcousticsProbesTab::GatherLandscape(
+    TArray<AcousticsMeshExtractionJob>& jobs, ALandscapeProxy* actor, MeshType type,
+    TArray<uint32>& materialIDsNotFound)
 {
 #if ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION < 22
     FRawMesh rawMesh;
@@ -899,11 +767,11 @@ void SAcousticsProbesTab::AddLandscapeToAcousticMesh(
     TArray<UMaterialInterface*> finalMats;
     finalMats.Add(staticMesh->GetMaterial(0));
 
-    AddStaticMeshToAcousticMesh(acousticMesh, nullptr, staticMesh, finalMats, type, materialIDsNotFound);
+    GatherStaticMesh(jobs, nullptr, staticMesh, finalMats, type, materialIDsNotFound);
 }
 
-void SAcousticsProbesTab::AddVolumeToAcousticMesh(
-    AcousticMesh* acousticMesh, AAcousticsProbeVolume* actor, TArray<uint32>& materialIDsNotFound)
+void SAcousticsProbesTab::GatherVolume(
+    TArray<AcousticsMeshExtractionJob>& jobs, AAcousticsProbeVolume* actor, TArray<uint32>& materialIDsNotFound)
 {
     TArray<UMaterialInterface*> emptyMaterials;
 
@@ -974,16 +842,11 @@ void SAcousticsProbesTab::AddVolumeToAcousticMesh(
     }
 
     // This exports the static mesh using the volume actor's transforms
-    AddStaticMeshToAcousticMesh(acousticMesh, actor, StaticMesh, emptyMaterials, type, materialIDsNotFound);
-}
-
-void SAcousticsProbesTab::AddPinnedProbeToAcousticMesh(AcousticMesh* acousticMesh, const FVector& probeLocation)
-{
-    acousticMesh->AddPinnedProbe(ATKVectorF{probeLocation.X, probeLocation.Y, probeLocation.Z});
+    GatherStaticMesh(jobs, actor, StaticMesh, emptyMaterials, type, materialIDsNotFound);
 }
 
-void SAcousticsProbesTab::AddNavmeshToAcousticMesh(
-    AcousticMesh* acousticMesh, ARecastNavMesh* navActor, TArray<UMaterialInterface*> materials,
+void SAcousticsProbesTab::GatherNavmesh(
+    TArray<AcousticsMeshExtractionJob>& jobs, ARecastNavMesh* navActor, TArray<UMaterialInterface*> materials,
     TArray<uint32>& materialIDsNotFound)
 {
     auto staticMesh = ExtractStaticMeshFromNavigationMesh(navActor, GEditor->GetWorld());
@@ -996,8 +859,7 @@ void SAcousticsProbesTab::AddNavmeshToAcousticMesh(
     const auto LOD = 0;
     if (staticMesh->HasValidRenderData(checkHasVerts, LOD))
     {
-        AddStaticMeshToAcousticMesh(
-            acousticMesh, navActor, staticMesh, materials, MeshTypeNavigation, materialIDsNotFound);
+        GatherStaticMesh(jobs, navActor, staticMesh, materials, MeshTypeNavigation, materialIDsNotFound);
         return;
     }
 
@@ -1016,8 +878,7 @@ void SAcousticsProbesTab::AddNavmeshToAcousticMesh(
     if (staticMeshRebuilt != nullptr && staticMeshRebuilt->HasValidRenderData(checkHasVerts, LOD))
     {
         UE_LOG(LogAcoustics, Log, TEXT("Nav mesh [%s] successfully rebuilt."), *navActor->GetName());
-        AddStaticMeshToAcousticMesh(
-            acousticMesh, navActor, staticMeshRebuilt, materials, MeshTypeNavigation, materialIDsNotFound);
+        GatherStaticMesh(jobs, navActor, staticMeshRebuilt, materials, MeshTypeNavigation, materialIDsNotFound);
     }
     else
     {
@@ -1030,38 +891,139 @@ void SAcousticsProbesTab::AddNavmeshToAcousticMesh(
     }
 }
 
-void SAcousticsProbesTab::ComputePrebake()
+void SAcousticsProbesTab::GatherMaterialVolumes()
 {
-    // First, collect all the Acoustic Material Override volumes
+    // Collect all the Acoustic Material Override volumes
     // We use these later to help figure out what material to assign to a mesh
     m_MaterialOverrideVolumes.Empty();
     // Also collect the Acoustic Material Remap volumes.
     m_MaterialRemapVolumes.Empty();
-    for (TActorIterator<AActor> itr(GEditor->GetEditorWorldContext().World()); itr; ++itr)
+    for (TActorIterator<AAcousticsProbeVolume> itr(GEditor->GetEditorWorldContext().World()); itr; ++itr)
     {
-        auto actor = *itr;
-        if (actor->IsA<AAcousticsProbeVolume>())
+        AAcousticsProbeVolume* volume = *itr;
+        if (volume->VolumeType != AcousticsVolumeType::MaterialOverride &&
+            volume->VolumeType != AcousticsVolumeType::MaterialRemap)
+        {
+            continue;
+        }
+
+        AcousticsMaterialVolume snapshot;
+        snapshot.Name = volume->GetName();
+        snapshot.Bounds = volume->GetBounds().GetBox();
+        if (volume->VolumeType == AcousticsVolumeType::MaterialOverride)
+        {
+            snapshot.MaterialName = volume->MaterialName;
+            m_MaterialOverrideVolumes.Add(MoveTemp(snapshot));
+        }
+        // Check material remap volumes as well.
+        else
         {
-            AAcousticsProbeVolume* volume = Cast<AAcousticsProbeVolume>(actor);
-            if (volume->VolumeType == AcousticsVolumeType::MaterialOverride)
+            snapshot.MaterialRemapping = volume->MaterialRemapping;
+            m_MaterialRemapVolumes.Add(MoveTemp(snapshot));
+        }
+    }
+}
+
+void SAcousticsProbesTab::ResolveMaterialVolumeCodes(const TArray<AcousticsMeshExtractionJob>& jobs)
+{
+    const auto* materialsLibrary = AcousticsSharedState::GetMaterialsLibrary();
+    if (materialsLibrary == nullptr)
+    {
+        return;
+    }
+
+    for (auto& overrideVolume : m_MaterialOverrideVolumes)
+    {
+        // Using the override material name prefix.
+        const FString overrideName = AAcousticsProbeVolume::OverrideMaterialNamePrefix + overrideVolume.MaterialName;
+        overrideVolume.HasOverrideCode = materialsLibrary->FindMaterialCode(overrideName, &overrideVolume.OverrideCode);
+        if (!overrideVolume.HasOverrideCode)
+        {
+            UE_LOG(
+                LogAcoustics,
+                Error,
+                TEXT("The material %s has no acoustic material mapping (it did not show up in the "
+                     "materials mapping tab), but is used by a mesh. Using the default code."),
+                *overrideName);
+        }
+    }
+
+    if (m_MaterialRemapVolumes.Num() == 0)
+    {
+        return;
+    }
+
+    // UE material name -> acoustic material name, as assigned in the materials tab
+    FAcousticsEdMode* AcousticsEdMode =
+        static_cast<FAcousticsEdMode*>(GLevelEditorModeTools().GetActiveMode(FAcousticsEdMode::EM_AcousticsEdModeId));
+    TMap<FString, FString> acousticMaterialNames;
+    for (const TSharedPtr<MaterialItem>& item : AcousticsEdMode->GetMaterialsTab()->GetMaterialItemsList())
+    {
+        acousticMaterialNames.FindOrAdd(item->UEMaterialName, item->AcousticMaterialName);
+    }
+
+    // Only the codes actually used by geometry can be remapped
+    TSet<TritonMaterialCode> usedCodes;
+    for (const auto& job : jobs)
+    {
+        if (job.Type == MeshTypeGeometry)
+        {
+            usedCodes.Append(job.SectionMaterialCodes);
+        }
+    }
+
+    for (const TritonMaterialCode code : usedCodes)
+    {
+        TritonAcousticMaterial acousticMaterial;
+        if (!TritonPreprocessor_MaterialLibrary_GetMaterialInfo(materialsLibrary->GetHandle(), code, &acousticMaterial))
+        {
+            continue;
+        }
+
+        const FString* acousticMaterialName = acousticMaterialNames.Find(FString(ANSI_TO_TCHAR(acousticMaterial.Name)));
+        const FString acousticMaterialToRemap = acousticMaterialName ? *acousticMaterialName : FString();
+
+        for (auto& remapVolume : m_MaterialRemapVolumes)
+        {
+            const FString* remappedMaterialName = remapVolume.MaterialRemapping.Find(acousticMaterialToRemap);
+            if (remappedMaterialName == nullptr)
+            {
+                continue;
+            }
+
+            const FString remappedAcousticMaterialName =
+                AAcousticsProbeVolume::RemapMaterialNamePrefix + *remappedMaterialName;
+            TritonMaterialCode remappedCode;
+            if (materialsLibrary->FindMaterialCode(remappedAcousticMaterialName, &remappedCode))
             {
-                m_MaterialOverrideVolumes.Add(volume);
+                remapVolume.RemappedCodes.Add(code, remappedCode);
             }
-            // Check material remap volumes as well.
-            else if (volume->VolumeType == AcousticsVolumeType::MaterialRemap)
+            else
             {
-                m_MaterialRemapVolumes.Add(volume);
+                UE_LOG(
+                    LogAcoustics,
+                    Error,
+                    TEXT("Invalid acoustic material %s found in the AcousticMaterialRemapping volume %s."),
+                    *remappedAcousticMaterialName,
+                    *remapVolume.Name);
             }
         }
     }
+}
+
+void SAcousticsProbesTab::ComputePrebake()
+{
+    // Gather: walk the world on the editor thread and snapshot everything extraction needs
+    const double gatherStartTime = FPlatformTime::Seconds();
+
+    GatherMaterialVolumes();
 
     // Used to track any materials that aren't properly mapped
     // Will display error text to help with debugging
     TArray<uint32> materialIDsNotFound;
     TArray<UMaterialInterface*> emptyMaterials;
-
-    // Create the acoustic mesh
-    TSharedPtr<AcousticMesh> acousticMesh = MakeShareable<AcousticMesh>(AcousticMesh::Create().Release());
+    TArray<AcousticsMeshExtractionJob> jobs;
+    TArray<FVector> pinnedProbes;
 
     for (TActorIterator<AActor> itr(GEditor->GetEditorWorldContext().World()); itr; ++itr)
     {
@@ -1074,19 +1036,17 @@ void SAcousticsProbesTab::ComputePrebake()
             // Nav Meshes
             if (actor->IsA<ARecastNavMesh>())
             {
-                AddNavmeshToAcousticMesh(
-                    acousticMesh.Get(), Cast<ARecastNavMesh>(actor), emptyMaterials, materialIDsNotFound);
+                GatherNavmesh(jobs, Cast<ARecastNavMesh>(actor), emptyMaterials, materialIDsNotFound);
             }
             // Volumes
             else if (actor->IsA<AAcousticsProbeVolume>())
             {
-                AddVolumeToAcousticMesh(acousticMesh.Get(), Cast<AAcousticsProbeVolume>(actor), materialIDsNotFound);
+                GatherVolume(jobs, Cast<AAcousticsProbeVolume>(actor), materialIDsNotFound);
             }
             // Pinned probes
             else if (actor->IsA<AAcousticsPinnedProbe>())
             {
-                auto probeLoc = TritonRuntime::UnrealPositionToTriton(actor->GetActorLocation());
-                AddPinnedProbeToAcousticMesh(acousticMesh.Get(), probeLoc);
+                pinnedProbes.Add(TritonRuntime::UnrealPositionToTriton(actor->GetActorLocation()));
             }
             else if (actor->IsA<AStaticMeshActor>())
             {
@@ -1102,8 +1062,8 @@ void SAcousticsProbesTab::ComputePrebake()
                     // Static meshes can be tagged for both AcousticsGeometry and AcousticsNavigation
                     // If that's the case, we need to make a copy of their geometry before adding it to the AcousticMesh
                     // It's not supported to have the same geometry contain both tags internally
-                    AddStaticMeshToAcousticMesh(
-                        acousticMesh.Get(),
+                    GatherStaticMesh(
+                        jobs,
                         actor,
                         meshComponent->GetStaticMesh(),
                         materials,
@@ -1121,7 +1081,7 @@ void SAcousticsProbesTab::ComputePrebake()
                     FVector ProbeLoc;
                     if (openingComponent->ComputeCenter(ProbeLoc))
                     {
-                        AddPinnedProbeToAcousticMesh(acousticMesh.Get(), ProbeLoc);
+                        pinnedProbes.Add(ProbeLoc);
                     }
                     else
                     {
@@ -1152,13 +1112,8 @@ void SAcousticsProbesTab::ComputePrebake()
                     // set.
                     TArray<UMaterialInterface*> materials = meshComponent->GetMaterials();
 
-                    AddStaticMeshToAcousticMesh(
-                        acousticMesh.Get(),
-                        actor,
-                        meshComponent->GetStaticMesh(),
-                        materials,
-                        MeshTypeGeometry,
-                        materialIDsNotFound);
+                    GatherStaticMesh(
+                        jobs, actor, meshComponent->GetStaticMesh(), materials, MeshTypeGeometry, materialIDsNotFound);
                 }
             }
             // Landscapes
@@ -1166,13 +1121,11 @@ void SAcousticsProbesTab::ComputePrebake()
             {
                 if (acousticNavigationTag)
                 {
-                    AddLandscapeToAcousticMesh(
-                        acousticMesh.Get(), Cast<ALandscapeProxy>(actor), MeshTypeNavigation, materialIDsNotFound);
+                    GatherLandscape(jobs, Cast<ALandscapeProxy>(actor), MeshTypeNavigation, materialIDsNotFound);
                 }
                 if (acousticGeometryTag)
                 {
-                    AddLandscapeToAcousticMesh(
-                        acousticMesh.Get(), Cast<ALandscapeProxy>(actor), MeshTypeGeometry, materialIDsNotFound);
+                    GatherLandscape(jobs, Cast<ALandscapeProxy>(actor), MeshTypeGeometry, materialIDsNotFound);
                 }
             }
             else
@@ -1182,19 +1135,48 @@ void SAcousticsProbesTab::ComputePrebake()
         }
     }
 
-    // Empty the override volumes list once it's done being used, so
-    // that we don't have to assume and depend on the mode deactivation code to clear it.
-    m_MaterialOverrideVolumes.Empty();
-    // Also empty the material remap volumes.
-    m_MaterialRemapVolumes.Empty();
+    // Resolve material names to codes once for every volume, instead of once per triangle
+    ResolveMaterialVolumeCodes(jobs);
+
+    // Hash every job, to reuse the geometry of unchanged ones and to report what changed since the last prebake
+    TArray<uint64> jobHashes;
+    AcousticsGeometryExtraction::HashJobs(jobs, m_MaterialOverrideVolumes, m_MaterialRemapVolumes, jobHashes);
+
+    TArray<AcousticsPrebakeManifestEntry> manifest;
+    manifest.Reserve(jobs.Num());
+    for (int32 i = 0; i < jobs.Num(); ++i)
+    {
+        manifest.Add(AcousticsPrebakeManifestEntry{jobHashes[i], jobs[i].Bounds, jobs[i].Name});
+    }
+    LogChangesSinceLastPrebake(manifest);
+
+    // Read the render data of the meshes that changed. This is the last access to engine geometry,
+    // everything after works on the snapshot in the background.
+    TArray<TSharedPtr<const AcousticsExtractedMesh>> extractedMeshes;
+    TArray<TSharedPtr<AcousticsCachedMesh>> jobMeshes;
+    AcousticsGeometryExtraction::ReadMeshes(jobs, jobHashes, extractedMeshes, jobMeshes);
+    for (auto& job : jobs)
+    {
+        // The mesh may be edited or deleted while the prebake runs
+        job.RenderData = nullptr;
+    }
 
-    if (!acousticMesh->HasNavigationMesh())
+    if (!jobs.ContainsByPredicate(
+            [](const AcousticsMeshExtractionJob& job) { return job.Type == MeshTypeNavigation; }))
     {
         UE_LOG(LogAcoustics, Error, TEXT("Need at least one object tagged for Navigation."));
         m_OwnerEdit->SetError(TEXT("Need at least one object tagged for Navigation to represent ground."));
         return;
     }
 
+    // Create the acoustic mesh
+    TSharedPtr<AcousticMesh> acousticMesh = MakeShareable<AcousticMesh>(AcousticMesh::Create().Release());
+
+    for (const FVector& probeLocation : pinnedProbes)
+    {
+        acousticMesh->AddPinnedProbe(ATKVectorF{probeLocation.X, probeLocation.Y, probeLocation.Z});
+    }
+
 #ifdef ENABLE_COLLISION_SUPPORT
     // Add collision geometry from selected actors to acoustic mesh as acoustic geometry
     if (!CollisionGeometryToAcousticMeshConverter::AddCollisionGeometryToAcousticMesh(acousticMesh.Get()))
@@ -1209,13 +1191,120 @@ void SAcousticsProbesTab::ComputePrebake()
         static_cast<FAcousticsEdMode*>(GLevelEditorModeTools().GetActiveMode(FAcousticsEdMode::EM_AcousticsEdModeId));
     AcousticsEdMode->GetMaterialsTab()->PublishMaterialLibrary();
 
+    UE_LOG(
+        LogAcoustics,
+        Display,
+        TEXT("Prebake snapshot: %d meshes in %.2fs. Extraction and voxelization continue in the background."),
+        jobs.Num(),
+        FPlatformTime::Seconds() - gatherStartTime);
+    SetStatus(TEXT("Extracting acoustic geometry"), 0.0f);
+
+    // Extract and merge on the worker thread that then voxelizes the result. Moving the override and remap volumes
+    // into it also empties them, so that we don't have to depend on the mode deactivation code to clear them.
+    auto buildAcousticMesh = [acousticMesh,
+                              jobs = MoveTemp(jobs),
+                              jobHashes = MoveTemp(jobHashes),
+                              jobMeshes = MoveTemp(jobMeshes),
+                              extractedMeshes = MoveTemp(extractedMeshes),
+                              overrideVolumes = MoveTemp(m_MaterialOverrideVolumes),
+                              remapVolumes = MoveTemp(m_MaterialRemapVolumes)]() -> TSharedPtr<AcousticMesh> {
+        // Extract: transform vertices and resolve per-triangle materials in parallel, for the meshes that changed
+        // since the last prebake
+        const double extractStartTime = FPlatformTime::Seconds();
+
+        TArray<TSharedPtr<const AcousticsExtractedMesh>> meshes = extractedMeshes;
+        const bool placed = AcousticsGeometryExtraction::PlaceMeshes(
+            jobs, jobHashes, jobMeshes, overrideVolumes, remapVolumes, meshes, [](float progress) {
+                SetStatus(TEXT("Extracting acoustic geometry"), progress);
+                return static_cast<bool>(m_CancelRequest);
+            });
+        if (!placed)
+        {
+            UE_LOG(LogAcoustics, Display, TEXT("Prebake cancelled while extracting geometry."));
+            return nullptr;
+        }
+
+        // Merge: hand everything to Triton in gather order
+        const double mergeStartTime = FPlatformTime::Seconds();
+
+        int32 triangleCount = 0;
+        for (int32 i = 0; i < jobs.Num(); ++i)
+        {
+            if (m_CancelRequest)
+            {
+                UE_LOG(LogAcoustics, Display, TEXT("Prebake cancelled while building the acoustic mesh."));
+                return nullptr;
+            }
+            SetStatus(TEXT("Building acoustic mesh"), static_cast<float>(i) / jobs.Num());
+
+            // Triton copies the geometry, the cast only works around its non-const API
+            AcousticsExtractedMesh& extracted = const_cast<AcousticsExtractedMesh&>(*meshes[i]);
+            triangleCount += extracted.TriangleInfos.Num();
+
+            if (jobs[i].Type == MeshTypeProbeSpacingVolume)
+            {
+                acousticMesh->AddProbeSpacingVolume(
+                    extracted.Vertices.GetData(),
+                    extracted.Vertices.Num(),
+                    extracted.TriangleInfos.GetData(),
+                    extracted.TriangleInfos.Num(),
+                    jobs[i].ProbeSpacing);
+            }
+            else
+            {
+                acousticMesh->Add(
+                    extracted.Vertices.GetData(),
+                    extracted.Vertices.Num(),
+                    extracted.TriangleInfos.GetData(),
+                    extracted.TriangleInfos.Num(),
+                    jobs[i].Type);
+            }
+        }
+
+        const double mergeEndTime = FPlatformTime::Seconds();
+        UE_LOG(
+            LogAcoustics,
+            Display,
+            TEXT("Prebake geometry: %d meshes, %d triangles. Extract %.2fs, merge %.2fs."),
+            jobs.Num(),
+            triangleCount,
+            mergeStartTime - extractStartTime,
+            mergeEndTime - mergeStartTime);
+
+        // Tagged navigation meshes can still turn out empty
+        if (!acousticMesh->HasNavigationMesh())
+        {
+            UE_LOG(LogAcoustics, Error, TEXT("Need at least one object tagged for Navigation."));
+            return nullptr;
+        }
+        return acousticMesh;
+    };
+
+    // Only record the geometry once the prebake succeeded, so that a cancelled or failed one is redone in full
+    auto saveManifest = [manifest = MoveTemp(manifest),
+                         manifestPath = AcousticsSharedState::GetPrebakeManifestFilepath()](bool created) {
+        if (!created || m_CancelRequest)
+        {
+            return;
+        }
+        if (!AcousticsPrebakeManifest::Save(manifestPath, manifest))
+        {
+            UE_LOG(
+                LogAcoustics,
+                Warning,
+                TEXT("Failed to write %s, the next prebake won't be able to report what changed."),
+                *manifestPath);
+        }
+    };
+
     auto config = AcousticsSimulationConfiguration::Create(
-        acousticMesh,
+        MoveTemp(buildAcousticMesh),
         AcousticsSharedState::GetTritonSimulationParameters(),
         AcousticsSharedState::GetTritonOperationalParameters(),
         AcousticsSharedState::GetMaterialsLibrary(),
         true,
-        &SAcousticsProbesTab::ComputePrebakeCallback);
+        &SAcousticsProbesTab::ComputePrebakeCallback,
+        MoveTemp(saveManifest));
     if (config)
     {
         AcousticsSharedState::SetSimulationConfiguration(MoveTemp(config));
@@ -1235,6 +1324,32 @@ void SAcousticsProbesTab::ComputePrebake()
     }
 }
 
+void SAcousticsProbesTab::LogChangesSinceLastPrebake(const TArray<AcousticsPrebakeManifestEntry>& manifest)
+{
+    TArray<AcousticsPrebakeManifestEntry> previousManifest;
+    if (!AcousticsPrebakeManifest::Load(AcousticsSharedState::GetPrebakeManifestFilepath(), previousManifest))
+    {
+        return;
+    }
+
+    int32 changedCount = 0;
+    const FBox changedRegion = AcousticsPrebakeManifest::FindChangedRegion(previousManifest, manifest, changedCount);
+    if (changedCount == 0)
+    {
+        UE_LOG(LogAcoustics, Display, TEXT("Prebake geometry is unchanged since the last prebake."));
+    }
+    else
+    {
+        UE_LOG(
+            LogAcoustics,
+            Display,
+            TEXT("Prebake geometry changed since the last prebake: %d meshes added, edited, moved or removed within "
+                 "%s."),
+            changedCount,
+            *changedRegion.ToString());
+    }
+}
+
 bool SAcousticsProbesTab::ShouldEnableForProcessing() const
 {
     return (AcousticsSharedState::GetSimulationConfiguration() == nullptr);
@@ -1244,36 +1359,38 @@ bool SAcousticsProbesTab::ComputePrebakeCallback(char* message, int progress)
 {
     FString uMessage(ANSI_TO_TCHAR(message));
     UE_LOG(LogAcoustics, Display, TEXT("%s"), *uMessage);
-    m_CurrentStatus = uMessage;
-    m_CurrentProgress = (progress / 100.0f);
+    SetStatus(uMessage, progress / 100.0f);
     return m_CancelRequest;
 }
 
+void SAcousticsProbesTab::SetStatus(const FString& status, float progress)
+{
+    FScopeLock lock(&m_StatusLock);
+    m_CurrentStatus = status;
+    m_CurrentProgress = progress;
+}
+
+FString SAcousticsProbesTab::GetCurrentStatus()
+{
+    FScopeLock lock(&m_StatusLock);
+    return m_CurrentStatus;
+}
+
 TOptional<float> SAcousticsProbesTab::GetProgressBarPercent() const
 {
+    FScopeLock lock(&m_StatusLock);
     return m_CurrentProgress;
 }
 
 EVisibility SAcousticsProbesTab::GetProgressBarVisibility() const
 {
+    FScopeLock lock(&m_StatusLock);
     return (m_CurrentProgress > 0 && m_CurrentProgress < 1) ? EVisibility::Visible : EVisibility::Collapsed;
 }
 
 void SAcousticsProbesTab::ResetPrebakeCalculationState()
 {
     m_CancelRequest = false;
-    m_CurrentStatus = TEXT("");
-    m_CurrentProgress = 0;
+    SetStatus(TEXT(""), 0.0f);
 }
-
-bool SAcousticsProbesTab::IsOverlapped(
-    const AAcousticsProbeVolume* ProbeVolume, const ATKVectorF& Vertex1, const ATKVectorF& Vertex2,
-    const ATKVectorF& Vertex3)
-{
-    auto bounds = ProbeVolume->GetBounds();
-    auto boundsBox = bounds.GetBox();
-    return boundsBox.IsInsideOrOn(TritonPositionToUnreal(FVector{Vertex1.x, Vertex1.y, Vertex1.z})) ||
-           boundsBox.IsInsideOrOn(TritonPositionToUnreal(FVector{Vertex2.x, Vertex2.y, Vertex2.z})) ||
-           boundsBox.IsInsideOrOn(TritonPositionToUnreal(FVector{Vertex3.x, Vertex3.y, Vertex3.z}));
-}
-#undef LOCTEXT_NAMESPACE
\ No newline at end of file
+#undef LOCTEXT_NAMESPACE
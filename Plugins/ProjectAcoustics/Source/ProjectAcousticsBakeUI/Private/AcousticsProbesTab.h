@@ -4,7 +4,10 @@
 #include "SAcousticsEdit.h"
 #include "Widgets/SCompoundWidget.h"
 #include "Runtime/Core/Public/Containers/Array.h"
+#include "Templates/Atomic.h"
+#include "HAL/CriticalSection.h"
 #include "AcousticsMesh.h"
+#include "AcousticsGeometryExtraction.h"
 #include "AcousticsProbesTab.generated.h"
 
 UENUM()
@@ -56,27 +59,31 @@ private:
     FText GetDataFolderPath() const;
     FReply OnAcousticsDataFolderButtonClick();
     void ComputePrebake();
-    void AddStaticMeshToAcousticMesh(
-        AcousticMesh* acousticMesh, AActor* actor, const UStaticMesh* mesh,
+    // Gather phase of ComputePrebake: snapshot geometry on the editor thread into extraction jobs
+    void GatherStaticMesh(
+        TArray<AcousticsMeshExtractionJob>& jobs, AActor* actor, const UStaticMesh* mesh,
         const TArray<UMaterialInterface*>& materials, MeshType type, TArray<uint32>& materialIDsNotFound);
-    void AddLandscapeToAcousticMesh(
-        AcousticMesh* acousticMesh, class ALandscapeProxy* actor, MeshType type, TArray<uint32>& materialIDsNotFound);
-    void AddVolumeToAcousticMesh(
-        AcousticMesh* acousticMesh, class AAcousticsProbeVolume* Actor, TArray<uint32>& materialIDsNotFound);
-    void AddPinnedProbeToAcousticMesh(AcousticMesh* acousticMesh, const FVector& probeLocation);
-
-    void AddNavmeshToAcousticMesh(
-        AcousticMesh* acousticMesh, class ARecastNavMesh* navActor, TArray<UMaterialInterface*> materials,
+    void GatherLandscape(
+        TArray<AcousticsMeshExtractionJob>& jobs, class ALandscapeProxy* actor, MeshType type,
+        TArray<uint32>& materialIDsNotFound);
+    void GatherVolume(
+        TArray<AcousticsMeshExtractionJob>& jobs, class AAcousticsProbeVolume* actor,
+        TArray<uint32>& materialIDsNotFound);
+    void GatherNavmesh(
+        TArray<AcousticsMeshExtractionJob>& jobs, class ARecastNavMesh* navActor, TArray<UMaterialInterface*> materials,
         TArray<uint32>& materialIDsNotFound);
+    void GatherMaterialVolumes();
+    void ResolveMaterialVolumeCodes(const TArray<AcousticsMeshExtractionJob>& jobs);
+    void LogChangesSinceLastPrebake(const TArray<AcousticsPrebakeManifestEntry>& manifest);
     bool ShouldEnableForProcessing() const;
     TOptional<float> GetProgressBarPercent() const;
     EVisibility GetProgressBarVisibility() const;
 
     static bool ComputePrebakeCallback(char* message, int progress);
     static void ResetPrebakeCalculationState();
-    static bool IsOverlapped(
-        const class AAcousticsProbeVolume* ProbeVolume, const ATKVectorF& Vertex1, const ATKVectorF& Vertex2,
-        const ATKVectorF& Vertex3);
+    // Prebake stages report progress from worker threads
+    static void SetStatus(const FString& status, float progress);
+    static FString GetCurrentStatus();
 
 private:
     TSharedPtr<FString> m_CurrentResolution;
@@ -84,10 +91,12 @@ private:
     TSharedPtr<class SEditableTextBox> m_PrefixTextBox;
     FString m_Prefix;
     SAcousticsEdit* m_OwnerEdit;
+    // Guards m_CurrentStatus and m_CurrentProgress
+    static FCriticalSection m_StatusLock;
     static FString m_CurrentStatus;
     static float m_CurrentProgress;
-    static bool m_CancelRequest;
+    static TAtomic<bool> m_CancelRequest;
 
-    TArray<class AAcousticsProbeVolume*> m_MaterialOverrideVolumes;
-    TArray<class AAcousticsProbeVolume*> m_MaterialRemapVolumes;
+    TArray<AcousticsMaterialVolume> m_MaterialOverrideVolumes;
+    TArray<AcousticsMaterialVolume> m_MaterialRemapVolumes;
 };
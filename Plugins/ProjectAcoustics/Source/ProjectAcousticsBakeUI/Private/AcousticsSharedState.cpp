@@ -291,6 +291,14 @@ FString AcousticsSharedState::GetConfigFilepath()
     return FPaths::Combine(config.content_dir, filename);
 }
 
+FString AcousticsSharedState::GetPrebakeManifestFilepath()
+{
+    const auto& config = m_PythonBridge->GetProjectConfiguration();
+    auto prefix = GetConfigurationPrefixForLevel();
+    auto filename = prefix + FString(TEXT("_prebake_hashes.txt"));
+    return FPaths::Combine(config.content_dir, filename);
+}
+
 FString AcousticsSharedState::GetAceFilepath()
 {
     const auto& config = m_PythonBridge->GetProjectConfiguration();
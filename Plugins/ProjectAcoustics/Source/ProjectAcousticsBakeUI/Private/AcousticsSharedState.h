@@ -36,6 +36,8 @@ public:
     static FString GetVoxFilepath();
     static FString GetConfigFilename();
     static FString GetConfigFilepath();
+    // Hashes of the geometry that went into the vox and config files, see AcousticsPrebakeManifest
+    static FString GetPrebakeManifestFilepath();
     static FString GetAceFilepath();
     // Function to get the file path to the ace backup.
     static FString GetAceFileBackupPath();
@@ -4,9 +4,16 @@
 #include "MathUtils.h"
 // Include for ENGINE_MAJOR_VERSION
 #include "Runtime/Launch/Resources/Version.h"
+#include "Misc/ScopeLock.h"
 
 using namespace TritonRuntime;
 
+// Voxel occupancy is cached in cubic bricks of this many voxels per side, packed z fastest
+static constexpr int32 c_VoxelBrickSize = 16;
+static constexpr int32 c_VoxelBrickWords = c_VoxelBrickSize * c_VoxelBrickSize * c_VoxelBrickSize / 64;
+static constexpr int32 c_VoxelBrickNotRead = -1;
+static constexpr int32 c_VoxelBrickEmpty = -2;
+
 AcousticsSimulationConfiguration::~AcousticsSimulationConfiguration()
 {
     if (m_CreateProbesFuture.IsValid())
@@ -31,9 +38,18 @@ TUniquePtr<AcousticsSimulationConfiguration> AcousticsSimulationConfiguration::C
     TSharedPtr<AcousticMesh> mesh, const TritonSimulationParameters& simulationParams,
     const TritonOperationalParameters& opParams, const AcousticsMaterialLibrary* library, bool force,
     TritonPreprocessorCallback callback)
+{
+    return Create([mesh]() { return mesh; }, simulationParams, opParams, library, force, callback);
+}
+
+TUniquePtr<AcousticsSimulationConfiguration> AcousticsSimulationConfiguration::Create(
+    TFunction<TSharedPtr<AcousticMesh>()> meshBuilder, const TritonSimulationParameters& simulationParams,
+    const TritonOperationalParameters& opParams, const AcousticsMaterialLibrary* library, bool force,
+    TritonPreprocessorCallback callback, TFunction<void(bool)> onCompleted)
 {
     auto instance = TUniquePtr<AcousticsSimulationConfiguration>(new AcousticsSimulationConfiguration());
-    if (!instance->Initialize(mesh, simulationParams, opParams, library, force, callback))
+    if (!instance->Initialize(
+            MoveTemp(meshBuilder), simulationParams, opParams, library, force, callback, MoveTemp(onCompleted)))
     {
         instance.Reset();
     }
@@ -117,26 +133,39 @@ bool AcousticsSimulationConfiguration::GetProbeList(
 }
 
 bool AcousticsSimulationConfiguration::Initialize(
-    TSharedPtr<AcousticMesh> mesh, const TritonSimulationParameters& simulationParams,
+    TFunction<TSharedPtr<AcousticMesh>()> meshBuilder, const TritonSimulationParameters& simulationParams,
     const TritonOperationalParameters& opParams, const AcousticsMaterialLibrary* library, bool force,
-    TritonPreprocessorCallback& callback)
+    TritonPreprocessorCallback& callback, TFunction<void(bool)> onCompleted)
 {
-    // Async processing to avoid blocking the UI thread
+    // Async processing to avoid blocking the UI thread. The builder may hold a lot of geometry, move it instead of
+    // copying.
+    auto createProbes = [=, meshBuilder = MoveTemp(meshBuilder), onCompleted = MoveTemp(onCompleted)]() -> bool {
+        auto mesh = meshBuilder();
+        bool created = false;
+        if (mesh.IsValid())
+        {
+            auto libraryHandle = library ? library->GetHandle() : nullptr;
+            created = TritonPreprocessor_SimulationConfiguration_Create(
+                mesh->GetHandle(),
+                const_cast<TritonSimulationParameters*>(&simulationParams),
+                const_cast<TritonOperationalParameters*>(&opParams),
+                libraryHandle,
+                force,
+                callback,
+                &m_Handle);
+        }
+
+        if (onCompleted)
+        {
+            onCompleted(created);
+        }
+        return created;
+    };
 #if ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION < 23
-    m_CreateProbesFuture = Async<bool>(EAsyncExecution::ThreadPool, [=]() {
+    m_CreateProbesFuture = Async<bool>(EAsyncExecution::ThreadPool, MoveTemp(createProbes));
 #else
-    m_CreateProbesFuture = Async(EAsyncExecution::ThreadPool, [=]() {
+    m_CreateProbesFuture = Async(EAsyncExecution::ThreadPool, MoveTemp(createProbes));
 #endif
-        auto libraryHandle = library ? library->GetHandle() : nullptr;
-        return TritonPreprocessor_SimulationConfiguration_Create(
-            mesh->GetHandle(),
-            const_cast<TritonSimulationParameters*>(&simulationParams),
-            const_cast<TritonOperationalParameters*>(&opParams),
-            libraryHandle,
-            force,
-            callback,
-            &m_Handle);
-    });
     return true;
 }
 
@@ -175,10 +204,166 @@ bool AcousticsSimulationConfiguration::GetVoxelMapInfo(
 
 bool AcousticsSimulationConfiguration::IsVoxelOccupied(int x, int y, int z) const
 {
-    bool occupied = false;
-    if (!TritonPreprocessor_SimulationConfiguration_IsVoxelOccupied(m_Handle, ATKVectorI{x, y, z}, &occupied))
+    FScopeLock lock(&m_VoxelLock);
+
+    if (!InitVoxelBricks() || x < 0 || y < 0 || z < 0 || x >= m_VoxelCounts.X || y >= m_VoxelCounts.Y ||
+        z >= m_VoxelCounts.Z)
+    {
+        return false;
+    }
+
+    const FIntVector voxel(x, y, z);
+    const FIntVector brick(x / c_VoxelBrickSize, y / c_VoxelBrickSize, z / c_VoxelBrickSize);
+    const uint64* bits = GetVoxelBrick(brick);
+    if (bits == nullptr)
+    {
+        return false;
+    }
+
+    const FIntVector local = voxel - brick * c_VoxelBrickSize;
+    const int32 bit = (local.X * c_VoxelBrickSize + local.Y) * c_VoxelBrickSize + local.Z;
+    return (bits[bit >> 6] & (1ull << (bit & 63))) != 0;
+}
+
+bool AcousticsSimulationConfiguration::GetVoxelOccupancy(
+    const FIntVector& minVoxel, const FIntVector& maxVoxel, TBitArray<>& outOccupied) const
+{
+    const FIntVector counts(
+        FMath::Max(maxVoxel.X - minVoxel.X, 0), FMath::Max(maxVoxel.Y - minVoxel.Y, 0),
+        FMath::Max(maxVoxel.Z - minVoxel.Z, 0));
+    outOccupied.Init(false, counts.X * counts.Y * counts.Z);
+
+    FScopeLock lock(&m_VoxelLock);
+
+    if (!InitVoxelBricks())
+    {
+        return false;
+    }
+
+    // Only the part of the range inside the map can be occupied
+    const FIntVector first(
+        FMath::Max(minVoxel.X, 0), FMath::Max(minVoxel.Y, 0), FMath::Max(minVoxel.Z, 0));
+    const FIntVector last(
+        FMath::Min(maxVoxel.X, m_VoxelCounts.X), FMath::Min(maxVoxel.Y, m_VoxelCounts.Y),
+        FMath::Min(maxVoxel.Z, m_VoxelCounts.Z));
+    if (first.X >= last.X || first.Y >= last.Y || first.Z >= last.Z)
+    {
+        return true;
+    }
+
+    // Copy brick by brick, skipping bricks without occupied voxels
+    for (int bx = first.X / c_VoxelBrickSize; bx <= (last.X - 1) / c_VoxelBrickSize; bx++)
+    {
+        for (int by = first.Y / c_VoxelBrickSize; by <= (last.Y - 1) / c_VoxelBrickSize; by++)
+        {
+            for (int bz = first.Z / c_VoxelBrickSize; bz <= (last.Z - 1) / c_VoxelBrickSize; bz++)
+            {
+                const FIntVector brick(bx, by, bz);
+                const uint64* bits = GetVoxelBrick(brick);
+                if (bits == nullptr)
+                {
+                    continue;
+                }
+
+                const FIntVector brickMin = brick * c_VoxelBrickSize;
+                const FIntVector brickMax = brickMin + FIntVector(c_VoxelBrickSize);
+                const FIntVector from(
+                    FMath::Max(first.X, brickMin.X), FMath::Max(first.Y, brickMin.Y), FMath::Max(first.Z, brickMin.Z));
+                const FIntVector to(
+                    FMath::Min(last.X, brickMax.X), FMath::Min(last.Y, brickMax.Y), FMath::Min(last.Z, brickMax.Z));
+
+                for (int x = from.X; x < to.X; x++)
+                {
+                    for (int y = from.Y; y < to.Y; y++)
+                    {
+                        const int32 brickRow =
+                            ((x - brickMin.X) * c_VoxelBrickSize + (y - brickMin.Y)) * c_VoxelBrickSize;
+                        const int32 outRow = ((x - minVoxel.X) * counts.Y + (y - minVoxel.Y)) * counts.Z;
+                        for (int z = from.Z; z < to.Z; z++)
+                        {
+                            const int32 bit = brickRow + (z - brickMin.Z);
+                            if (bits[bit >> 6] & (1ull << (bit & 63)))
+                            {
+                                outOccupied[outRow + (z - minVoxel.Z)] = true;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return true;
+}
+
+bool AcousticsSimulationConfiguration::InitVoxelBricks() const
+{
+    if (m_VoxelBrickOffsets.Num() > 0)
+    {
+        return true;
+    }
+
+    TritonBoundingBox box;
+    ATKVectorI voxelCounts;
+    float cellSize;
+    if (!TritonPreprocessor_SimulationConfiguration_GetVoxelMapInfo(m_Handle, &box, &voxelCounts, &cellSize))
     {
         return false;
     }
-    return occupied;
+
+    m_VoxelCounts = FIntVector(voxelCounts.x, voxelCounts.y, voxelCounts.z);
+    m_VoxelBrickCounts = FIntVector(
+        FMath::DivideAndRoundUp(m_VoxelCounts.X, c_VoxelBrickSize),
+        FMath::DivideAndRoundUp(m_VoxelCounts.Y, c_VoxelBrickSize),
+        FMath::DivideAndRoundUp(m_VoxelCounts.Z, c_VoxelBrickSize));
+    m_VoxelBrickOffsets.Init(c_VoxelBrickNotRead, m_VoxelBrickCounts.X * m_VoxelBrickCounts.Y * m_VoxelBrickCounts.Z);
+    return true;
+}
+
+const uint64* AcousticsSimulationConfiguration::GetVoxelBrick(const FIntVector& brick) const
+{
+    int32& offset =
+        m_VoxelBrickOffsets[(brick.X * m_VoxelBrickCounts.Y + brick.Y) * m_VoxelBrickCounts.Z + brick.Z];
+
+    if (offset == c_VoxelBrickNotRead)
+    {
+        uint64 bits[c_VoxelBrickWords] = {};
+        bool anyOccupied = false;
+
+        const FIntVector brickMin = brick * c_VoxelBrickSize;
+        const FIntVector brickMax(
+            FMath::Min(brickMin.X + c_VoxelBrickSize, m_VoxelCounts.X),
+            FMath::Min(brickMin.Y + c_VoxelBrickSize, m_VoxelCounts.Y),
+            FMath::Min(brickMin.Z + c_VoxelBrickSize, m_VoxelCounts.Z));
+        for (int x = brickMin.X; x < brickMax.X; x++)
+        {
+            for (int y = brickMin.Y; y < brickMax.Y; y++)
+            {
+                for (int z = brickMin.Z; z < brickMax.Z; z++)
+                {
+                    bool occupied = false;
+                    if (TritonPreprocessor_SimulationConfiguration_IsVoxelOccupied(
+                            m_Handle, ATKVectorI{x, y, z}, &occupied) &&
+                        occupied)
+                    {
+                        const int32 bit = ((x - brickMin.X) * c_VoxelBrickSize + (y - brickMin.Y)) * c_VoxelBrickSize +
+                                          (z - brickMin.Z);
+                        bits[bit >> 6] |= 1ull << (bit & 63);
+                        anyOccupied = true;
+                    }
+                }
+            }
+        }
+
+        if (anyOccupied)
+        {
+            offset = m_VoxelBrickBits.Num();
+            m_VoxelBrickBits.Append(bits, c_VoxelBrickWords);
+        }
+        else
+        {
+            offset = c_VoxelBrickEmpty;
+        }
+    }
+
+    return offset == c_VoxelBrickEmpty ? nullptr : &m_VoxelBrickBits[offset];
 }
@@ -5,6 +5,8 @@
 #include "Runtime/Core/Public/Async/Future.h"
 #include "Runtime/Core/Public/Misc/Paths.h"
 #include "Runtime/Core/Public/Math/IntVector.h"
+#include "Runtime/Core/Public/Containers/BitArray.h"
+#include "Runtime/Core/Public/HAL/CriticalSection.h"
 #include "TritonPreprocessorApi.h"
 #include "AcousticsMesh.h"
 #include "AcousticsMaterialLibrary.h"
@@ -29,6 +31,13 @@ public:
         TSharedPtr<AcousticMesh> mesh, const TritonSimulationParameters& simulationParams,
         const TritonOperationalParameters& opParams, const AcousticsMaterialLibrary* library, bool force,
         TritonPreprocessorCallback callback);
+    // Builds the acoustic mesh on the worker thread that creates the configuration, so none of it blocks the caller.
+    // The configuration fails if the builder returns null, e.g. when cancelled. onCompleted is called on that worker
+    // thread once the configuration is ready (true) or failed (false).
+    static TUniquePtr<AcousticsSimulationConfiguration> Create(
+        TFunction<TSharedPtr<AcousticMesh>()> meshBuilder, const TritonSimulationParameters& simulationParams,
+        const TritonOperationalParameters& opParams, const AcousticsMaterialLibrary* library, bool force,
+        TritonPreprocessorCallback callback, TFunction<void(bool)> onCompleted = nullptr);
 
     SimulationConfigurationState GetState() const;
 
@@ -39,6 +48,9 @@ public:
 
     bool GetVoxelMapInfo(FBox& box, FBox& boxTriton, FIntVector& voxelCounts, float& cellSize) const;
     bool IsVoxelOccupied(int x, int y, int z) const;
+    // Occupancy of every voxel in [minVoxel, maxVoxel), one bit per voxel indexed ((x * countY) + y) * countZ + z
+    // relative to minVoxel. Voxels outside of the map are air. Only valid once the configuration is ready.
+    bool GetVoxelOccupancy(const FIntVector& minVoxel, const FIntVector& maxVoxel, TBitArray<>& outOccupied) const;
 
 private:
     AcousticsSimulationConfiguration() : m_Handle(nullptr)
@@ -46,13 +58,29 @@ private:
     }
 
     bool Initialize(
-        TSharedPtr<AcousticMesh> mesh, const TritonSimulationParameters& simulationParams,
+        TFunction<TSharedPtr<AcousticMesh>()> meshBuilder, const TritonSimulationParameters& simulationParams,
         const TritonOperationalParameters& opParams, const AcousticsMaterialLibrary* library, bool force,
-        TritonPreprocessorCallback& callback);
+        TritonPreprocessorCallback& callback, TFunction<void(bool)> onCompleted);
 
     bool Initialize(const FString& workingDir, const FString& configFilename);
 
+    // Sizes the brick cache from the voxel map on first use. Call with m_VoxelLock held.
+    bool InitVoxelBricks() const;
+    // Bits of a brick of the voxel map, or null if none of its voxels are occupied. The preprocessor is queried
+    // once per voxel the first time its brick is used. Call with m_VoxelLock held, the pointer is only valid
+    // until the next brick is read.
+    const uint64* GetVoxelBrick(const FIntVector& brick) const;
+
 private:
     TritonObject m_Handle;
     TFuture<bool> m_CreateProbesFuture;
+
+    // Occupancy cache, as a voxel map of millions of voxels is too slow to query one call per voxel.
+    // Voxels are immutable once the configuration is ready, so the cache never needs invalidating.
+    mutable FCriticalSection m_VoxelLock;
+    mutable FIntVector m_VoxelCounts;
+    mutable FIntVector m_VoxelBrickCounts;
+    // Per brick, x-major: offset into m_VoxelBrickBits, or a marker for bricks not read yet or without occupied voxels
+    mutable TArray<int32> m_VoxelBrickOffsets;
+    mutable TArray<uint64> m_VoxelBrickBits;
 };
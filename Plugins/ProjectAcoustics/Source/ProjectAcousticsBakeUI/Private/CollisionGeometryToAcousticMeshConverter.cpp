@@ -8,24 +8,150 @@
 #include "Editor/UnrealEd/Classes/Exporters/FbxExportOption.h"
 #include "Editor/UnrealEd/Classes/Exporters/StaticMeshExporterFBX.h"
 #include "Runtime/Engine/Classes/PhysicalMaterials/PhysicalMaterial.h"
+#include "Runtime/Engine/Classes/PhysicsEngine/BodySetup.h"
+#include "Runtime/Engine/Classes/Components/StaticMeshComponent.h"
+#include "Runtime/Engine/Public/DynamicMeshBuilder.h"
+#include "Interfaces/Interface_CollisionDataProvider.h"
+#include "AcousticsSharedState.h"
+#include "MathUtils.h"
+
+using namespace TritonRuntime;
+
+// Tessellation of spheres and capsules. Segments around the axis, and rings from the equator to a pole.
+static const int32 c_CollisionRoundSegments = 16;
+static const int32 c_CollisionRoundRings = 4;
+
+// Appends triangles in Triton space for positions given in the element's local space
+static void AddCollisionTriangles(
+    const TArray<FVector>& positions, const TArray<int32>& indices, const FTransform& localToWorld,
+    TritonMaterialCode materialCode, TArray<ATKVectorF>& vertices,
+    TArray<TritonAcousticMeshTriangleInformation>& triangles)
+{
+    const int32 firstVertex = vertices.Num();
+    for (const auto& position : positions)
+    {
+        const FVector tritonPosition = UnrealPositionToTriton(localToWorld.TransformPosition(position));
+        vertices.Add(ATKVectorF{tritonPosition.X, tritonPosition.Y, tritonPosition.Z});
+    }
+
+    for (int32 i = 0; i + 2 < indices.Num(); i += 3)
+    {
+        TritonAcousticMeshTriangleInformation info;
+        info.Indices =
+            ATKVectorI{firstVertex + indices[i], firstVertex + indices[i + 1], firstVertex + indices[i + 2]};
+        info.MaterialCode = materialCode;
+        triangles.Add(info);
+    }
+}
+
+static void TessellateBox(const FKBoxElem& box, TArray<FVector>& positions, TArray<int32>& indices)
+{
+    // Corner bits select +X, +Y and +Z
+    for (int32 corner = 0; corner < 8; ++corner)
+    {
+        positions.Add(FVector(
+            (corner & 1 ? 0.5f : -0.5f) * box.X,
+            (corner & 2 ? 0.5f : -0.5f) * box.Y,
+            (corner & 4 ? 0.5f : -0.5f) * box.Z));
+    }
+
+    static const int32 faces[6][4] = {
+        {0, 2, 6, 4}, {1, 5, 7, 3}, {0, 4, 5, 1}, {2, 3, 7, 6}, {0, 1, 3, 2}, {4, 6, 7, 5}};
+    for (const auto& face : faces)
+    {
+        indices.Append({face[0], face[1], face[2], face[0], face[2], face[3]});
+    }
+}
+
+// Capsule along Z, or a sphere when halfLength is zero
+static void TessellateCapsule(float radius, float halfLength, TArray<FVector>& positions, TArray<int32>& indices)
+{
+    // Rings from the bottom to the top pole, poles excluded. A sphere shares its equator between both halves.
+    TArray<TPair<float, float>> rings; // Z, ring radius
+    for (int32 ring = 1; ring <= c_CollisionRoundRings; ++ring)
+    {
+        const float angle = HALF_PI * (static_cast<float>(ring) / c_CollisionRoundRings - 1.0f);
+        rings.Emplace(-halfLength + radius * FMath::Sin(angle), radius * FMath::Cos(angle));
+    }
+    for (int32 ring = halfLength > 0.0f ? 0 : 1; ring < c_CollisionRoundRings; ++ring)
+    {
+        const float angle = HALF_PI * static_cast<float>(ring) / c_CollisionRoundRings;
+        rings.Emplace(halfLength + radius * FMath::Sin(angle), radius * FMath::Cos(angle));
+    }
+
+    const int32 bottomPole = positions.Add(FVector(0.0f, 0.0f, -halfLength - radius));
+    const int32 firstRing = positions.Num();
+    for (const auto& ring : rings)
+    {
+        for (int32 segment = 0; segment < c_CollisionRoundSegments; ++segment)
+        {
+            const float angle = 2.0f * PI * segment / c_CollisionRoundSegments;
+            positions.Add(FVector(ring.Value * FMath::Cos(angle), ring.Value * FMath::Sin(angle), ring.Key));
+        }
+    }
+    const int32 topPole = positions.Add(FVector(0.0f, 0.0f, halfLength + radius));
+
+    auto ringVertex = [firstRing](int32 ring, int32 segment) {
+        return firstRing + ring * c_CollisionRoundSegments + segment % c_CollisionRoundSegments;
+    };
+    const int32 lastRing = rings.Num() - 1;
+    for (int32 segment = 0; segment < c_CollisionRoundSegments; ++segment)
+    {
+        indices.Append({bottomPole, ringVertex(0, segment + 1), ringVertex(0, segment)});
+        for (int32 ring = 0; ring < lastRing; ++ring)
+        {
+            const int32 below = ringVertex(ring, segment);
+            const int32 belowNext = ringVertex(ring, segment + 1);
+            const int32 above = ringVertex(ring + 1, segment);
+            const int32 aboveNext = ringVertex(ring + 1, segment + 1);
+            indices.Append({below, belowNext, aboveNext});
+            indices.Append({below, aboveNext, above});
+        }
+        indices.Append({topPole, ringVertex(lastRing, segment), ringVertex(lastRing, segment + 1)});
+    }
+}
 
 bool CollisionGeometryToAcousticMeshConverter::AddCollisionGeometryToAcousticMesh(AcousticMesh* acousticMesh)
 {
-    TArray<AActor*> actors;
+    TArray<AActor*> fbxActors;
     for (TActorIterator<AActor> itr(GEditor->GetEditorWorldContext().World()); itr; ++itr)
     {
         auto actor = *itr;
-        if (HasCollisionTag(actor))
+        if (!HasCollisionTag(actor))
+        {
+            continue;
+        }
+
+        TArray<ATKVectorF> vertices;
+        TArray<TritonAcousticMeshTriangleInformation> triangles;
+        if (!ExtractCollisionGeometry(actor, vertices, triangles))
+        {
+            fbxActors.Add(actor);
+            continue;
+        }
+
+        if (!acousticMesh->Add(
+                vertices.GetData(), vertices.Num(), triangles.GetData(), triangles.Num(), MeshTypeGeometry))
         {
-            actors.Add(actor);
+            return false;
         }
     }
 
+    if (fbxActors.Num() == 0)
+    {
+        return true;
+    }
+
     // We rely on UE4 to export the PhysX collision geometry to an intermediate FBX file.
     // This FBX is then parsed and the geometry from collision nodes (UCX_*) is added
     // to the acoustic mesh as acoustic geometry.
+    UE_LOG(
+        LogAcoustics,
+        Log,
+        TEXT("%d actors tagged for collision geometry have no readable body setup, exporting them through FBX."),
+        fbxActors.Num());
     FString fbxFilepath;
-    auto result = ExportCollisionsToFbx(actors, &fbxFilepath);
+    auto result = ExportCollisionsToFbx(fbxActors, &fbxFilepath);
     if (result)
     {
         result = ImportCollisionsFromFbx(acousticMesh, fbxFilepath);
@@ -33,6 +159,129 @@ bool CollisionGeometryToAcousticMeshConverter::AddCollisionGeometryToAcousticMes
     return result;
 }
 
+TritonMaterialCode CollisionGeometryToAcousticMeshConverter::GetMaterialCode(
+    const TArray<UMaterialInterface*>& materials)
+{
+    TritonMaterialCode code = TRITON_DEFAULT_WALL_CODE;
+    const auto* materialsLibrary = AcousticsSharedState::GetMaterialsLibrary();
+    if (materialsLibrary == nullptr ||
+        !materialsLibrary->FindMaterialCode(ExtractPhysicalMaterialName(materials).ToString(), &code))
+    {
+        code = TRITON_DEFAULT_WALL_CODE;
+    }
+    return code;
+}
+
+bool CollisionGeometryToAcousticMeshConverter::ExtractCollisionGeometry(
+    AActor* actor, TArray<ATKVectorF>& vertices, TArray<TritonAcousticMeshTriangleInformation>& triangles)
+{
+    TInlineComponentArray<UStaticMeshComponent*> components;
+    actor->GetComponents(components);
+
+    for (UStaticMeshComponent* component : components)
+    {
+        UBodySetup* bodySetup = component->GetBodySetup();
+        if (bodySetup == nullptr)
+        {
+            continue;
+        }
+
+        const FTransform& componentToWorld = component->GetComponentTransform();
+        const TArray<UMaterialInterface*> materials = component->GetMaterials();
+        const TritonMaterialCode materialCode = GetMaterialCode(materials);
+
+        // Meshes using their render geometry as collision have no simple shapes worth reading
+        UStaticMesh* staticMesh = component->GetStaticMesh();
+        if (bodySetup->GetCollisionTraceFlag() == CTF_UseComplexAsSimple && staticMesh != nullptr &&
+            staticMesh->ContainsPhysicsTriMeshData(true))
+        {
+            FTriMeshCollisionData triMesh;
+            if (staticMesh->GetPhysicsTriMeshData(&triMesh, true))
+            {
+                // Materials are assigned per triangle, resolve each material once
+                TMap<uint16, TritonMaterialCode> sectionCodes;
+                const int32 firstVertex = vertices.Num();
+                for (const FVector& position : triMesh.Vertices)
+                {
+                    const FVector tritonPosition = UnrealPositionToTriton(componentToWorld.TransformPosition(position));
+                    vertices.Add(ATKVectorF{tritonPosition.X, tritonPosition.Y, tritonPosition.Z});
+                }
+                for (int32 i = 0; i < triMesh.Indices.Num(); ++i)
+                {
+                    const uint16 materialIndex = i < triMesh.MaterialIndices.Num() ? triMesh.MaterialIndices[i] : 0;
+                    const TritonMaterialCode* sectionCode = sectionCodes.Find(materialIndex);
+                    if (sectionCode == nullptr)
+                    {
+                        TArray<UMaterialInterface*> sectionMaterials;
+                        sectionMaterials.Add(component->GetMaterial(materialIndex));
+                        sectionCode = &sectionCodes.Add(materialIndex, GetMaterialCode(sectionMaterials));
+                    }
+
+                    const FTriIndices& indices = triMesh.Indices[i];
+                    TritonAcousticMeshTriangleInformation info;
+                    info.Indices = ATKVectorI{
+                        firstVertex + indices.v0, firstVertex + indices.v1, firstVertex + indices.v2};
+                    info.MaterialCode = *sectionCode;
+                    triangles.Add(info);
+                }
+                continue;
+            }
+        }
+
+        // Simple collision shapes, tessellated in their own space. Under non-uniform scale spheres and capsules
+        // become ellipsoids, where physics would keep them round; close enough for acoustics.
+        const FKAggregateGeom& aggGeom = bodySetup->AggGeom;
+        TArray<FVector> positions;
+        TArray<int32> indices;
+        for (const FKBoxElem& box : aggGeom.BoxElems)
+        {
+            positions.Reset();
+            indices.Reset();
+            TessellateBox(box, positions, indices);
+            AddCollisionTriangles(
+                positions, indices, box.GetTransform() * componentToWorld, materialCode, vertices, triangles);
+        }
+        for (const FKSphereElem& sphere : aggGeom.SphereElems)
+        {
+            positions.Reset();
+            indices.Reset();
+            TessellateCapsule(sphere.Radius, 0.0f, positions, indices);
+            AddCollisionTriangles(
+                positions, indices, sphere.GetTransform() * componentToWorld, materialCode, vertices, triangles);
+        }
+        for (const FKSphylElem& sphyl : aggGeom.SphylElems)
+        {
+            positions.Reset();
+            indices.Reset();
+            TessellateCapsule(sphyl.Radius, 0.5f * sphyl.Length, positions, indices);
+            AddCollisionTriangles(
+                positions, indices, sphyl.GetTransform() * componentToWorld, materialCode, vertices, triangles);
+        }
+        for (const FKConvexElem& convex : aggGeom.ConvexElems)
+        {
+            // Let the engine triangulate the hull, as it does to draw it
+            TArray<FDynamicMeshVertex> hullVertices;
+            TArray<uint32> hullIndices;
+            convex.AddCachedSolidConvexGeom(hullVertices, hullIndices, FColor::White);
+
+            positions.Reset();
+            indices.Reset();
+            for (const auto& hullVertex : hullVertices)
+            {
+                positions.Add(hullVertex.Position);
+            }
+            for (const uint32 hullIndex : hullIndices)
+            {
+                indices.Add(static_cast<int32>(hullIndex));
+            }
+            AddCollisionTriangles(
+                positions, indices, convex.GetTransform() * componentToWorld, materialCode, vertices, triangles);
+        }
+    }
+
+    return triangles.Num() > 0;
+}
+
 //
 // "Waterfalls" through the material hierarchy and tries to find the most detailed material
 // name for use by the acoustics system.
@@ -23,6 +23,14 @@ private:
     }
 
     static FName ExtractPhysicalMaterialName(const TArray<UMaterialInterface*>& Materials);
+    static TritonMaterialCode GetMaterialCode(const TArray<UMaterialInterface*>& materials);
+
+    // Reads the collision of the actor's static mesh components straight from their body setups.
+    // Returns false if there was none to read, in which case the actor goes through the FBX route.
+    static bool ExtractCollisionGeometry(
+        AActor* actor, TArray<ATKVectorF>& vertices, TArray<TritonAcousticMeshTriangleInformation>& triangles);
+
+    // Fallback for actors whose collision can't be read directly, through an FBX export and import
     static bool ExportCollisionsToFbx(const TArray<AActor*>& actors, FString* fbxFilepath);
     static bool ImportCollisionsFromFbx(AcousticMesh* acouticsMesh, const FString& fbxFilepath);
 };
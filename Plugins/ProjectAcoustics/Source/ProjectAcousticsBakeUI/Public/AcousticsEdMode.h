@@ -107,11 +107,19 @@ public:
     bool TagGeometry(bool tag);
     bool TagNavigation(bool tag);
 
+    // Broadcast for every actor TagGeometry or TagNavigation changed
+    DECLARE_EVENT_OneParam(FAcousticsEdMode, FOnActorTagsChanged, AActor*);
+    FOnActorTagsChanged& OnActorTagsChanged()
+    {
+        return m_OnActorTagsChanged;
+    }
+
     // Configuration Helper
     bool GetConfigFile(FConfigFile** configFile, FString& configFilePath);
 
 private:
     void BindCommands();
+    void OnMapChange(uint32 changeType);
 
 private:
     TSharedPtr<SAcousticsMaterialsTab> m_materialsTab;
@@ -119,4 +127,7 @@ private:
 
     FConfigFile m_ConfigFile;
     FString m_ConfigFilePath;
+
+    FOnActorTagsChanged m_OnActorTagsChanged;
+    FDelegateHandle m_MapChangeHandle;
 };
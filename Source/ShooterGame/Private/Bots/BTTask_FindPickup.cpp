@@ -7,7 +7,7 @@
 #include "BehaviorTree/Blackboard/BlackboardKeyAllTypes.h"
 #include "Bots/ShooterAIController.h"
 #include "Bots/ShooterBot.h"
-#include "Pickups/ShooterPickup_Ammo.h"
+#include "Pickups/ShooterPickup.h"
 #include "Weapons/ShooterWeapon_Instant.h"
 
 UBTTask_FindPickup::UBTTask_FindPickup(const FObjectInitializer& ObjectInitializer) 
@@ -30,23 +30,8 @@ EBTNodeResult::Type UBTTask_FindPickup::ExecuteTask(UBehaviorTreeComponent& Owne
 		return EBTNodeResult::Failed;
 	}
 
-	const FVector MyLoc = MyBot->GetActorLocation();
-	AShooterPickup_Ammo* BestPickup = NULL;
-	float BestDistSq = MAX_FLT;
-
-	for (int32 i = 0; i < GameMode->LevelPickups.Num(); ++i)
-	{
-		AShooterPickup_Ammo* AmmoPickup = Cast<AShooterPickup_Ammo>(GameMode->LevelPickups[i]);
-		if (AmmoPickup && AmmoPickup->IsForWeapon(AShooterWeapon_Instant::StaticClass()) && AmmoPickup->CanBePickedUp(MyBot))
-		{
-			const float DistSq = (AmmoPickup->GetActorLocation() - MyLoc).SizeSquared();
-			if (BestDistSq == -1 || DistSq < BestDistSq)
-			{
-				BestDistSq = DistSq;
-				BestPickup = AmmoPickup;
-			}
-		}
-	}
+	// ammo pickups are indexed under the weapon class they refill
+	AShooterPickup* BestPickup = GameMode->FindNearestPickup(AShooterWeapon_Instant::StaticClass(), MyBot);
 
 	if (BestPickup)
 	{
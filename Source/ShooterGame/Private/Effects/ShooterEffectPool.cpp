@@ -0,0 +1,55 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "Effects/ShooterEffectPool.h"
+#include "Effects/ShooterImpactEffect.h"
+#include "Particles/ParticleSystemComponent.h"
+
+DECLARE_STATS_GROUP(TEXT("ShooterEffects"), STATGROUP_ShooterEffects, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Impacts Spawned"), STAT_ShooterImpactsSpawned, STATGROUP_ShooterEffects);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Trails Spawned"), STAT_ShooterTrailsSpawned, STATGROUP_ShooterEffects);
+
+static int32 EffectPoolEnable = 1;
+static FAutoConsoleVariableRef CVarEffectPoolEnable(
+	TEXT("p.EffectPool.Enable"),
+	EffectPoolEnable,
+	TEXT("Recycle impact and trail particle systems through the particle system component pool.\n")
+	TEXT("0: Disable, 1: Enable"),
+	ECVF_Default);
+
+AShooterImpactEffect* UShooterEffectPool::SpawnImpactEffect(TSubclassOf<AShooterImpactEffect> ImpactTemplate, const FTransform& SpawnTransform, const FHitResult& SurfaceHit)
+{
+	if (!ImpactTemplate)
+	{
+		return nullptr;
+	}
+
+	// the actor plays its effects and destroys itself right away, only its particle systems outlive it
+	AShooterImpactEffect* EffectActor = GetWorld()->SpawnActorDeferred<AShooterImpactEffect>(ImpactTemplate, SpawnTransform);
+	if (EffectActor)
+	{
+		EffectActor->SurfaceHit = SurfaceHit;
+		EffectActor->bUsePooledEmitters = EffectPoolEnable != 0;
+		UGameplayStatics::FinishSpawningActor(EffectActor, SpawnTransform);
+		NumImpactsSpawned++;
+		INC_DWORD_STAT(STAT_ShooterImpactsSpawned);
+	}
+	return EffectActor;
+}
+
+UParticleSystemComponent* UShooterEffectPool::SpawnTrailEffect(UParticleSystem* TrailTemplate, const FVector& Origin)
+{
+	if (!TrailTemplate)
+	{
+		return nullptr;
+	}
+
+	const EPSCPoolMethod PoolMethod = EffectPoolEnable ? EPSCPoolMethod::AutoRelease : EPSCPoolMethod::None;
+	UParticleSystemComponent* TrailPSC = UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), TrailTemplate, Origin, FRotator::ZeroRotator, FVector(1.0f), true, PoolMethod);
+	if (TrailPSC)
+	{
+		NumTrailsSpawned++;
+		INC_DWORD_STAT(STAT_ShooterTrailsSpawned);
+	}
+	return TrailPSC;
+}
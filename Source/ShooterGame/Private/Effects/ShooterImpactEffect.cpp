@@ -6,12 +6,15 @@
 AShooterImpactEffect::AShooterImpactEffect(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	SetAutoDestroyWhenFinished(true);
+	bUsePooledEmitters = false;
 }
 
 void AShooterImpactEffect::PostInitializeComponents()
 {
 	Super::PostInitializeComponents();
 
+	const EPSCPoolMethod PoolMethod = bUsePooledEmitters ? EPSCPoolMethod::AutoRelease : EPSCPoolMethod::None;
+
 	UPhysicalMaterial* HitPhysMat = SurfaceHit.PhysMaterial.Get();
 	EPhysicalSurface HitSurfaceType = UPhysicalMaterial::DetermineSurfaceType(HitPhysMat);
 
@@ -19,7 +22,7 @@ void AShooterImpactEffect::PostInitializeComponents()
 	UParticleSystem* ImpactFX = GetImpactFX(HitSurfaceType);
 	if (ImpactFX)
 	{
-		UGameplayStatics::SpawnEmitterAtLocation(this, ImpactFX, GetActorLocation(), GetActorRotation());
+		UGameplayStatics::SpawnEmitterAtLocation(this, ImpactFX, GetActorLocation(), GetActorRotation(), FVector(1.0f), true, PoolMethod);
 	}
 
 	// play sound
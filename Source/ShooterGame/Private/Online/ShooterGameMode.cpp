@@ -10,7 +10,16 @@
 #include "Online/ShooterGameSession.h"
 #include "Bots/ShooterAIController.h"
 #include "ShooterTeamStart.h"
+#include "Pickups/ShooterPickup.h"
+#include "NavigationSystem.h"
 
+static int32 PickupNavCandidates = 3;
+static FAutoConsoleVariableRef CVarPickupNavCandidates(
+	TEXT("p.PickupNavCandidates"),
+	PickupNavCandidates,
+	TEXT("Number of nearest pickups compared by navigation path length when a bot looks for a pickup.\n")
+	TEXT("0: Use straight-line distance only"),
+	ECVF_Default);
 
 AShooterGameMode::AShooterGameMode(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
@@ -569,3 +578,68 @@ void AShooterGameMode::RestartGame()
 	Super::RestartGame();
 }
 
+void AShooterGameMode::RegisterPickup(AShooterPickup* Pickup)
+{
+	LevelPickups.AddUnique(Pickup);
+	PickupIndex.UpdatePickup(Pickup, Pickup->IsPickupActive());
+}
+
+void AShooterGameMode::UnregisterPickup(AShooterPickup* Pickup)
+{
+	LevelPickups.RemoveSingleSwap(Pickup, false);
+	PickupIndex.RemovePickup(Pickup);
+}
+
+void AShooterGameMode::OnPickupAvailabilityChanged(AShooterPickup* Pickup)
+{
+	// respawn is also called from the pickup's BeginPlay, before it registers
+	if (LevelPickups.Contains(Pickup))
+	{
+		PickupIndex.UpdatePickup(Pickup, Pickup->IsPickupActive());
+	}
+}
+
+AShooterPickup* AShooterGameMode::FindNearestPickup(UClass* CategoryClass, AShooterCharacter* ForPawn) const
+{
+	if (ForPawn == nullptr)
+	{
+		return nullptr;
+	}
+
+	const FVector PawnLoc = ForPawn->GetActorLocation();
+	const int32 NumCandidates = FMath::Max(PickupNavCandidates, 1);
+
+	TArray<FShooterPickupIndex::FCandidate> Candidates;
+	PickupIndex.FindNearest(CategoryClass, PawnLoc, NumCandidates, [ForPawn](AShooterPickup* Pickup) { return Pickup->CanBePickedUp(ForPawn); }, Candidates);
+
+	if (Candidates.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if (Candidates.Num() == 1 || PickupNavCandidates <= 0 || NavSys == nullptr)
+	{
+		return Candidates[0].Pickup;
+	}
+
+	// the straight-line nearest pickup may be behind a wall, pick the one with the shortest path
+	AShooterPickup* BestPickup = nullptr;
+	float BestPathLength = MAX_FLT;
+	for (const FShooterPickupIndex::FCandidate& Candidate : Candidates)
+	{
+		float PathLength = 0.0f;
+		if (NavSys->GetPathLength(PawnLoc, Candidate.Pickup->GetActorLocation(), PathLength) != ENavigationQueryResult::Success)
+		{
+			continue;
+		}
+
+		if (PathLength < BestPathLength)
+		{
+			BestPathLength = PathLength;
+			BestPickup = Candidate.Pickup;
+		}
+	}
+
+	return BestPickup ? BestPickup : Candidates[0].Pickup;
+}
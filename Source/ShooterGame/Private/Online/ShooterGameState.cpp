@@ -9,6 +9,8 @@ AShooterGameState::AShooterGameState(const FObjectInitializer& ObjectInitializer
 	NumTeams = 0;
 	RemainingTime = 0;
 	bTimerPaused = false;
+	RankedMapVersion = 0;
+	bRankedMapsDirty = true;
 }
 
 void AShooterGameState::GetLifetimeReplicatedProps( TArray< FLifetimeProperty > & OutLifetimeProps ) const
@@ -23,34 +25,88 @@ void AShooterGameState::GetLifetimeReplicatedProps( TArray< FLifetimeProperty >
 
 void AShooterGameState::GetRankedMap(int32 TeamIndex, RankedPlayerMap& OutRankedMap) const
 {
-	OutRankedMap.Empty();
+	const RankedPlayerMap* RankedMap = GetRankedMapRef(TeamIndex);
+	if (RankedMap)
+	{
+		OutRankedMap = *RankedMap;
+	}
+	else
+	{
+		OutRankedMap.Empty();
+	}
+}
+
+const RankedPlayerMap* AShooterGameState::GetRankedMapRef(int32 TeamIndex) const
+{
+	UpdateRankedMaps();
+	return RankedMaps.IsValidIndex(TeamIndex) ? &RankedMaps[TeamIndex] : nullptr;
+}
+
+uint32 AShooterGameState::GetRankedMapVersion() const
+{
+	UpdateRankedMaps();
+	return RankedMapVersion;
+}
 
-	//first, we need to go over all the PlayerStates, grab their score, and rank them
-	TMultiMap<int32, AShooterPlayerState*> SortedMap;
-	for(int32 i = 0; i < PlayerArray.Num(); ++i)
+void AShooterGameState::InvalidateRankedMaps()
+{
+	bRankedMapsDirty = true;
+}
+
+void AShooterGameState::AddPlayerState(APlayerState* PlayerState)
+{
+	Super::AddPlayerState(PlayerState);
+	InvalidateRankedMaps();
+}
+
+void AShooterGameState::RemovePlayerState(APlayerState* PlayerState)
+{
+	Super::RemovePlayerState(PlayerState);
+	InvalidateRankedMaps();
+}
+
+void AShooterGameState::UpdateRankedMaps() const
+{
+	// NumTeams is replicated separately from the player states, so a change there also needs a rebuild
+	const int32 NumRankedTeams = FMath::Max(NumTeams, 1);
+	if (!bRankedMapsDirty && RankedMaps.Num() == NumRankedTeams)
+	{
+		return;
+	}
+
+	//first, we need to go over all the PlayerStates and grab their score
+	TArray<AShooterPlayerState*> SortedPlayers;
+	SortedPlayers.Reserve(PlayerArray.Num());
+	for (int32 i = 0; i < PlayerArray.Num(); ++i)
 	{
-		int32 Score = 0;
 		AShooterPlayerState* CurPlayerState = Cast<AShooterPlayerState>(PlayerArray[i]);
-		if (CurPlayerState && (CurPlayerState->GetTeamNum() == TeamIndex))
+		if (CurPlayerState)
 		{
-			SortedMap.Add(FMath::TruncToInt(CurPlayerState->GetScore()), CurPlayerState);
+			SortedPlayers.Add(CurPlayerState);
 		}
 	}
 
-	//sort by the keys
-	SortedMap.KeySort(TGreater<int32>());
-
-	//now, add them back to the ranked map
-	OutRankedMap.Empty();
+	//rank them by score, highest first
+	SortedPlayers.StableSort([](const AShooterPlayerState& A, const AShooterPlayerState& B)
+	{
+		return FMath::TruncToInt(A.GetScore()) > FMath::TruncToInt(B.GetScore());
+	});
 
-	int32 Rank = 0;
-	for(TMultiMap<int32, AShooterPlayerState*>::TIterator It(SortedMap); It; ++It)
+	//now, add them to the ranked map of their team
+	RankedMaps.Reset();
+	RankedMaps.AddDefaulted(NumRankedTeams);
+	for (AShooterPlayerState* CurPlayerState : SortedPlayers)
 	{
-		OutRankedMap.Add(Rank++, It.Value());
+		const int32 TeamIndex = CurPlayerState->GetTeamNum();
+		if (RankedMaps.IsValidIndex(TeamIndex))
+		{
+			RankedMaps[TeamIndex].Add(RankedMaps[TeamIndex].Num(), CurPlayerState);
+		}
 	}
-	
-}
 
+	bRankedMapsDirty = false;
+	RankedMapVersion++;
+}
 
 void AShooterGameState::RequestFinishAndExitToMainMenu()
 {
@@ -25,6 +25,8 @@ void AShooterPlayerState::Reset()
 	NumBulletsFired = 0;
 	NumRocketsFired = 0;
 	bQuitter = false;
+
+	InvalidateRanking();
 }
 
 void AShooterPlayerState::RegisterPlayerWithSession(bool bWasFromInvite)
@@ -55,11 +57,30 @@ void AShooterPlayerState::SetTeamNum(int32 NewTeamNumber)
 	TeamNumber = NewTeamNumber;
 
 	UpdateTeamColors();
+	InvalidateRanking();
 }
 
 void AShooterPlayerState::OnRep_TeamColor()
 {
 	UpdateTeamColors();
+	InvalidateRanking();
+}
+
+void AShooterPlayerState::OnRep_Score()
+{
+	Super::OnRep_Score();
+
+	InvalidateRanking();
+}
+
+void AShooterPlayerState::InvalidateRanking()
+{
+	UWorld* const World = GetWorld();
+	AShooterGameState* const MyGameState = World ? World->GetGameState<AShooterGameState>() : nullptr;
+	if (MyGameState)
+	{
+		MyGameState->InvalidateRankedMaps();
+	}
 }
 
 void AShooterPlayerState::AddBulletsFired(int32 NumBullets)
@@ -157,6 +178,7 @@ void AShooterPlayerState::ScorePoints(int32 Points)
 	}
 
 	SetScore(GetScore() + Points);
+	InvalidateRanking();
 }
 
 void AShooterPlayerState::InformAboutKill_Implementation(class AShooterPlayerState* KillerPlayerState, const UDamageType* KillerDamageType, class AShooterPlayerState* KilledPlayerState)
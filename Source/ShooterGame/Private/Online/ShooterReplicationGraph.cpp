@@ -40,6 +40,16 @@
 *		to simulated connections at a low, steady frequency, and to take advantage of serialization sharing. Auto proxy player states are replicated at higher frequency (to the
 *		owning connection only) via UShooterReplicationGraphNode_AlwaysRelevant_ForConnection.
 *		
+*		UShooterReplicationGraphNode_AcousticRelevancy_ForConnection
+*		Connection specific node that uses baked acoustics (Project Acoustics) to decide how relevant characters are to a connection. Characters the viewer could hear
+*		beyond their cull distance are gathered and have their cull distance raised for that connection. Characters within cull distance that the viewer couldn't hear
+*		(e.g. behind thick walls) get a longer replication period. Loudness is cached per actor and refreshed a few actors per frame. Without acoustic data the
+*		regular distance based settings apply.
+*		Queries only succeed for pairs inside the region of the ACE file loaded on the server, and there is a single loaded region per process. With
+*		AutoStream it follows the local listener, so on a listen server only connections near the host benefit. Dedicated servers have no listener,
+*		so the node is off there unless ShooterRepGraph.Acoustics.DedicatedServer is set, which promises the server loads the whole ACE file
+*		(AutoStream off and ForceLoadTile with a tile covering the map).
+*		
 *		UReplicationGraphNode_TearOff_ForConnection
 *		Connection specific node for handling tear off actors. This is created and managed in the base implementation of Replication Graph.
 *		
@@ -97,6 +107,7 @@
 #include "Online/ShooterPlayerState.h"
 #include "Weapons/ShooterWeapon.h"
 #include "Pickups/ShooterPickup.h"
+#include "IAcoustics.h"
 
 DEFINE_LOG_CATEGORY( LogShooterReplicationGraph );
 
@@ -124,6 +135,31 @@ static FAutoConsoleVariableRef CVarShooterRepDynamicActorFrequencyBuckets(TEXT("
 int32 CVar_ShooterRepGraph_DisableSpatialRebuilds = 1;
 static FAutoConsoleVariableRef CVarShooterRepDisableSpatialRebuilds(TEXT("ShooterRepGraph.DisableSpatialRebuilds"), CVar_ShooterRepGraph_DisableSpatialRebuilds, TEXT(""), ECVF_Default );
 
+int32 CVar_ShooterRepGraph_Acoustics_Enable = 1;
+static FAutoConsoleVariableRef CVarShooterRepGraphAcousticsEnable(TEXT("ShooterRepGraph.Acoustics.Enable"), CVar_ShooterRepGraph_Acoustics_Enable, TEXT("Use baked acoustics to adjust character relevancy per connection"), ECVF_Default );
+
+// Loudness at the viewer of a sound that is 0 dB at 1m from the character. Quieter than this is inaudible.
+float CVar_ShooterRepGraph_Acoustics_AudibleThresholdDb = -60.f;
+static FAutoConsoleVariableRef CVarShooterRepGraphAcousticsAudibleThresholdDb(TEXT("ShooterRepGraph.Acoustics.AudibleThresholdDb"), CVar_ShooterRepGraph_Acoustics_AudibleThresholdDb, TEXT("Loudness (dB) below which a character is considered inaudible to a connection"), ECVF_Default );
+
+// Max distance (not squared) audible characters are replicated at
+float CVar_ShooterRepGraph_Acoustics_AudibleCullDistance = 30000.f;
+static FAutoConsoleVariableRef CVarShooterRepGraphAcousticsAudibleCullDistance(TEXT("ShooterRepGraph.Acoustics.AudibleCullDistance"), CVar_ShooterRepGraph_Acoustics_AudibleCullDistance, TEXT("Max distance (not squared) to replicate audible characters at"), ECVF_Default );
+
+// Replication period multiplier for inaudible characters within cull distance
+int32 CVar_ShooterRepGraph_Acoustics_InaudiblePeriodScale = 4;
+static FAutoConsoleVariableRef CVarShooterRepGraphAcousticsInaudiblePeriodScale(TEXT("ShooterRepGraph.Acoustics.InaudiblePeriodScale"), CVar_ShooterRepGraph_Acoustics_InaudiblePeriodScale, TEXT("Replication period multiplier for inaudible characters"), ECVF_Default );
+
+float CVar_ShooterRepGraph_Acoustics_CacheSeconds = 0.25f;
+static FAutoConsoleVariableRef CVarShooterRepGraphAcousticsCacheSeconds(TEXT("ShooterRepGraph.Acoustics.CacheSeconds"), CVar_ShooterRepGraph_Acoustics_CacheSeconds, TEXT("How long cached loudness stays valid"), ECVF_Default );
+
+int32 CVar_ShooterRepGraph_Acoustics_MaxQueriesPerFrame = 8;
+static FAutoConsoleVariableRef CVarShooterRepGraphAcousticsMaxQueriesPerFrame(TEXT("ShooterRepGraph.Acoustics.MaxQueriesPerFrame"), CVar_ShooterRepGraph_Acoustics_MaxQueriesPerFrame, TEXT("Max acoustic queries per connection per replication frame"), ECVF_Default );
+
+// Acoustic data is streamed around a single listener, which a dedicated server doesn't have. Only set this if the server loads the whole ACE file.
+int32 CVar_ShooterRepGraph_Acoustics_DedicatedServer = 0;
+static FAutoConsoleVariableRef CVarShooterRepGraphAcousticsDedicatedServer(TEXT("ShooterRepGraph.Acoustics.DedicatedServer"), CVar_ShooterRepGraph_Acoustics_DedicatedServer, TEXT("Use acoustic relevancy on dedicated servers. Requires the whole ACE file to be loaded on the server"), ECVF_Default );
+
 // ----------------------------------------------------------------------------------------------------------
 
 
@@ -156,6 +192,7 @@ void UShooterReplicationGraph::ResetGameWorldState()
 	Super::ResetGameWorldState();
 
 	AlwaysRelevantStreamingLevelActors.Empty();
+	AcousticRelevancyActors.Reset();
 
 	for (UNetReplicationGraphConnection* ConnManager : Connections)
 	{
@@ -385,6 +422,9 @@ void UShooterReplicationGraph::InitGlobalGraphNodes()
 	AlwaysRelevantNode = CreateNewNode<UReplicationGraphNode_ActorList>();
 	AddGlobalGraphNode(AlwaysRelevantNode);
 
+	// Characters are also tracked here, for acoustic relevancy
+	AcousticRelevancyActors.PrepareForWrite();
+
 	// -----------------------------------------------
 	//	Player State specialization. This will return a rolling subset of the player states to replicate
 	// -----------------------------------------------
@@ -403,6 +443,10 @@ void UShooterReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConn
 	RepGraphConnection->OnClientVisibleLevelNameRemove.AddUObject(AlwaysRelevantConnectionNode, &UShooterReplicationGraphNode_AlwaysRelevant_ForConnection::OnClientLevelVisibilityRemove);
 
 	AddConnectionGraphNode(AlwaysRelevantConnectionNode, RepGraphConnection);
+
+	UShooterReplicationGraphNode_AcousticRelevancy_ForConnection* AcousticRelevancyNode = CreateNewNode<UShooterReplicationGraphNode_AcousticRelevancy_ForConnection>();
+	AddConnectionGraphNode(AcousticRelevancyNode, RepGraphConnection);
+	AcousticRelevancyNodes.Add(AcousticRelevancyNode);
 }
 
 EClassRepNodeMapping UShooterReplicationGraph::GetMappingPolicy(UClass* Class)
@@ -455,6 +499,11 @@ void UShooterReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedA
 			break;
 		}
 	};
+
+	if (ActorInfo.Class->IsChildOf(AShooterCharacter::StaticClass()))
+	{
+		AcousticRelevancyActors.ConditionalAdd(ActorInfo.Actor);
+	}
 }
 
 void UShooterReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
@@ -502,6 +551,24 @@ void UShooterReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicat
 			break;
 		}
 	};
+
+	if (ActorInfo.Class->IsChildOf(AShooterCharacter::StaticClass()))
+	{
+		AcousticRelevancyActors.Remove(ActorInfo.Actor);
+
+		// The connection nodes cache per actor, drop the entries before the actor goes away
+		for (int32 Idx = AcousticRelevancyNodes.Num() - 1; Idx >= 0; --Idx)
+		{
+			if (UShooterReplicationGraphNode_AcousticRelevancy_ForConnection* Node = AcousticRelevancyNodes[Idx].Get())
+			{
+				Node->ForgetActor(ActorInfo.Actor);
+			}
+			else
+			{
+				AcousticRelevancyNodes.RemoveAtSwap(Idx);
+			}
+		}
+	}
 }
 
 // Since we listen to global (static) events, we need to watch out for cross world broadcasts (PIE)
@@ -757,6 +824,154 @@ void UShooterReplicationGraphNode_AlwaysRelevant_ForConnection::LogNode(FReplica
 
 // ------------------------------------------------------------------------------
 
+/** Loudness at the listener of a sound that is 0 dB at 1m from the source. Returns false if there is no acoustic data for this pair. */
+static bool GetAcousticLoudnessDb(IAcoustics& Acoustics, const FVector& SourceLocation, const FVector& ListenerLocation, float& OutLoudnessDb)
+{
+	TritonAcousticParameters AcousticParams;
+	if (!Acoustics.QueryAcousticsNoDebug(SourceLocation, ListenerLocation, AcousticParams))
+	{
+		return false;
+	}
+
+	// Direct loudness doesn't include distance attenuation. Add 1/r attenuation along the shortest path around geometry.
+	const float PathLength = FMath::Max(100.f, Acoustics.TritonDelayToUnrealDistance(AcousticParams.DirectDelay));
+	const float DirectDb = AcousticParams.DirectLoudnessDB + 20.f * FMath::LogX(10.f, 100.f / PathLength);
+	OutLoudnessDb = FMath::Max(DirectDb, AcousticParams.ReflectionsLoudnessDB);
+	return true;
+}
+
+void UShooterReplicationGraphNode_AcousticRelevancy_ForConnection::ApplyAudibility(FConnectionReplicationActorInfo& ConnectionActorInfo, const FGlobalActorReplicationInfo& GlobalInfo, EAudibility Audibility) const
+{
+	const FClassReplicationInfo& ClassInfo = GlobalInfo.Settings;
+	switch (Audibility)
+	{
+		case EAudibility::Audible:
+		{
+			const float AudibleCullDistanceSquared = CVar_ShooterRepGraph_Acoustics_AudibleCullDistance * CVar_ShooterRepGraph_Acoustics_AudibleCullDistance;
+			ConnectionActorInfo.SetCullDistanceSquared(FMath::Max(ClassInfo.GetCullDistanceSquared(), AudibleCullDistanceSquared));
+			ConnectionActorInfo.ReplicationPeriodFrame = ClassInfo.ReplicationPeriodFrame;
+			break;
+		}
+
+		case EAudibility::Inaudible:
+		{
+			ConnectionActorInfo.SetCullDistanceSquared(ClassInfo.GetCullDistanceSquared());
+			ConnectionActorInfo.ReplicationPeriodFrame = ClassInfo.ReplicationPeriodFrame * FMath::Max(CVar_ShooterRepGraph_Acoustics_InaudiblePeriodScale, 1);
+			break;
+		}
+
+		case EAudibility::Unknown:
+		{
+			ConnectionActorInfo.SetCullDistanceSquared(ClassInfo.GetCullDistanceSquared());
+			ConnectionActorInfo.ReplicationPeriodFrame = ClassInfo.ReplicationPeriodFrame;
+			break;
+		}
+	}
+}
+
+void UShooterReplicationGraphNode_AcousticRelevancy_ForConnection::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	QUICK_SCOPE_CYCLE_COUNTER( UShooterReplicationGraphNode_AcousticRelevancy_ForConnection_GatherActorListsForConnection );
+
+	ReplicationActorList.Reset();
+
+	if (!CVar_ShooterRepGraph_Acoustics_Enable || !IAcoustics::IsAvailable() || Params.Viewers.Num() == 0)
+	{
+		return;
+	}
+
+	// Without a listener nothing is streamed in, every query would fail
+	if (GetWorld()->GetNetMode() == NM_DedicatedServer && !CVar_ShooterRepGraph_Acoustics_DedicatedServer)
+	{
+		return;
+	}
+
+	UShooterReplicationGraph* ShooterGraph = CastChecked<UShooterReplicationGraph>(GetOuter());
+	IAcoustics& Acoustics = IAcoustics::Get();
+
+	// Split screen viewers share a connection. Listen from the first one.
+	const FNetViewer& Viewer = Params.Viewers[0];
+	const AController* ViewerController = Cast<AController>(Viewer.InViewer);
+	const AActor* ViewerPawn = ViewerController ? ViewerController->GetPawn() : nullptr;
+
+	const double Now = FPlatformTime::Seconds();
+	int32 QueriesLeft = CVar_ShooterRepGraph_Acoustics_MaxQueriesPerFrame;
+
+	for (FActorRepListType Actor : ShooterGraph->AcousticRelevancyActors)
+	{
+		// The connection's own pawn and view target are always relevant, see UShooterReplicationGraphNode_AlwaysRelevant_ForConnection
+		if (Actor == ViewerPawn || Actor == Viewer.ViewTarget || !IsActorValidForReplicationGather(Actor))
+		{
+			continue;
+		}
+
+		FAudibilityInfo& Info = AudibilityCache.FindOrAdd(Actor);
+		Info.LastSeenFrame = Params.ReplicationFrameNum;
+
+		EAudibility NewAudibility = Info.Audibility;
+		if ((Now - Info.LastQueryTime > CVar_ShooterRepGraph_Acoustics_CacheSeconds) && QueriesLeft > 0)
+		{
+			QueriesLeft--;
+			Info.LastQueryTime = Now;
+			if (GetAcousticLoudnessDb(Acoustics, Actor->GetActorLocation(), Viewer.ViewLocation, Info.LoudnessDb))
+			{
+				NewAudibility = Info.LoudnessDb >= CVar_ShooterRepGraph_Acoustics_AudibleThresholdDb ? EAudibility::Audible : EAudibility::Inaudible;
+			}
+			else
+			{
+				NewAudibility = EAudibility::Unknown;
+			}
+		}
+
+		FGlobalActorReplicationInfo& GlobalInfo = GraphGlobals->GlobalActorReplicationInfoMap->Get(Actor);
+		if (NewAudibility != Info.Audibility)
+		{
+			Info.Audibility = NewAudibility;
+			ApplyAudibility(Params.ConnectionManager.ActorInfoMap.FindOrAdd(Actor), GlobalInfo, NewAudibility);
+		}
+
+		// The grid only returns actors near the viewer, gather audible ones that are further away
+		if (Info.Audibility == EAudibility::Audible && FVector::DistSquared(Actor->GetActorLocation(), Viewer.ViewLocation) > GlobalInfo.Settings.GetCullDistanceSquared())
+		{
+			ReplicationActorList.ConditionalAdd(Actor);
+		}
+	}
+
+	// Forget actors that are no longer gathered, removed actors are dropped in ForgetActor
+	if (AudibilityCache.Num() > ShooterGraph->AcousticRelevancyActors.Num())
+	{
+		for (auto It = AudibilityCache.CreateIterator(); It; ++It)
+		{
+			if (It.Value().LastSeenFrame != Params.ReplicationFrameNum)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	if (ReplicationActorList.Num() > 0)
+	{
+		Params.OutGatheredReplicationLists.AddReplicationActorList(ReplicationActorList);
+	}
+}
+
+void UShooterReplicationGraphNode_AcousticRelevancy_ForConnection::LogNode(FReplicationGraphDebugInfo& DebugInfo, const FString& NodeName) const
+{
+	DebugInfo.Log(NodeName);
+	DebugInfo.PushIndent();
+	LogActorRepList(DebugInfo, TEXT("Audible beyond cull distance"), ReplicationActorList);
+
+	for (const auto& It : AudibilityCache)
+	{
+		const TCHAR* AudibilityStr = It.Value.Audibility == EAudibility::Audible ? TEXT("Audible") : (It.Value.Audibility == EAudibility::Inaudible ? TEXT("Inaudible") : TEXT("Unknown"));
+		DebugInfo.Log(FString::Printf(TEXT("%s: %s (%.1f dB)"), *GetActorRepListTypeDebugString(It.Key), AudibilityStr, It.Value.LoudnessDb));
+	}
+
+	DebugInfo.PopIndent();
+}
+
+// ------------------------------------------------------------------------------
+
 UShooterReplicationGraphNode_PlayerStateFrequencyLimiter::UShooterReplicationGraphNode_PlayerStateFrequencyLimiter()
 {
 	bRequiresPrepareForReplicationCall = true;
@@ -60,6 +60,12 @@ public:
 	UPROPERTY()
 	UReplicationGraphNode_ActorList* AlwaysRelevantNode;
 
+	/** Sound emitting actors (characters) whose relevancy is adjusted by UShooterReplicationGraphNode_AcousticRelevancy_ForConnection */
+	FActorRepListRefView AcousticRelevancyActors;
+
+	/** Per connection acoustic nodes, told when an acoustic relevancy actor is removed. Weak since connections come and go. */
+	TArray<TWeakObjectPtr<class UShooterReplicationGraphNode_AcousticRelevancy_ForConnection>> AcousticRelevancyNodes;
+
 	TMap<FName, FActorRepListRefView> AlwaysRelevantStreamingLevelActors;
 
 	void OnCharacterEquipWeapon(AShooterCharacter* Character, AShooterWeapon* NewWeapon);
@@ -120,6 +126,57 @@ private:
 	bool bInitializedPlayerState = false;
 };
 
+/**
+ * Connection specific node that adjusts character relevancy by how well the connection's viewer could hear them,
+ * using acoustic parameters from Project Acoustics. Audible characters beyond their cull distance are gathered and
+ * replicated, characters inside cull distance that are inaudible (e.g. behind thick walls) replicate less often.
+ * Weapons are dependent actors of their character and follow along.
+ */
+UCLASS()
+class UShooterReplicationGraphNode_AcousticRelevancy_ForConnection : public UReplicationGraphNode
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void NotifyAddNetworkActor(const FNewReplicatedActorInfo& Actor) override { }
+	virtual bool NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound=true) override { return false; }
+	virtual void NotifyResetAllNetworkActors() override { AudibilityCache.Reset(); }
+
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+
+	virtual void LogNode(FReplicationGraphDebugInfo& DebugInfo, const FString& NodeName) const override;
+
+	/** Drops the cached loudness of an actor leaving the graph */
+	void ForgetActor(FActorRepListType Actor) { AudibilityCache.Remove(Actor); }
+
+private:
+
+	enum class EAudibility : uint8
+	{
+		Unknown,		// No acoustic data, distance based relevancy applies
+		Audible,
+		Inaudible,
+	};
+
+	struct FAudibilityInfo
+	{
+		float LoudnessDb = 0.f;
+		double LastQueryTime = -1.0;
+		uint32 LastSeenFrame = 0;
+		EAudibility Audibility = EAudibility::Unknown;
+	};
+
+	/** Applies audibility to the connection's replication settings for this actor */
+	void ApplyAudibility(FConnectionReplicationActorInfo& ConnectionActorInfo, const FGlobalActorReplicationInfo& GlobalInfo, EAudibility Audibility) const;
+
+	/** Cached loudness per actor, at the connection's viewer. Actors are removed through ForgetActor before they are destroyed. */
+	TMap<FActorRepListType, FAudibilityInfo> AudibilityCache;
+
+	/** Audible actors beyond their cull distance */
+	FActorRepListRefView ReplicationActorList;
+};
+
 /** This is a specialized node for handling PlayerState replication in a frequency limited fashion. It tracks all player states but only returns a subset of them to the replication driver each frame. */
 UCLASS()
 class UShooterReplicationGraphNode_PlayerStateFrequencyLimiter : public UReplicationGraphNode
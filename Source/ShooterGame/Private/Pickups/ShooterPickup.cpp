@@ -33,14 +33,25 @@ void AShooterPickup::BeginPlay()
 
 	RespawnPickup();
 
-	// register on pickup list (server only), don't care about unregistering (in FinishDestroy) - no streaming
+	// register on pickup list (server only)
 	AShooterGameMode* GameMode = GetWorld()->GetAuthGameMode<AShooterGameMode>();
 	if (GameMode)
 	{
-		GameMode->LevelPickups.Add(this);
+		GameMode->RegisterPickup(this);
 	}
 }
 
+void AShooterPickup::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	AShooterGameMode* GameMode = GetWorld()->GetAuthGameMode<AShooterGameMode>();
+	if (GameMode)
+	{
+		GameMode->UnregisterPickup(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AShooterPickup::NotifyActorBeginOverlap(class AActor* Other)
 {
 	Super::NotifyActorBeginOverlap(Other);
@@ -52,6 +63,16 @@ bool AShooterPickup::CanBePickedUp(class AShooterCharacter* TestPawn) const
 	return TestPawn && TestPawn->IsAlive();
 }
 
+UClass* AShooterPickup::GetPickupCategory() const
+{
+	return GetClass();
+}
+
+bool AShooterPickup::IsPickupActive() const
+{
+	return bIsActive;
+}
+
 void AShooterPickup::GivePickupTo(class AShooterCharacter* Pawn)
 {
 }
@@ -70,6 +91,11 @@ void AShooterPickup::PickupOnTouch(class AShooterCharacter* Pawn)
 				bIsActive = false;
 				OnPickedUp();
 
+				if (AShooterGameMode* GameMode = GetWorld()->GetAuthGameMode<AShooterGameMode>())
+				{
+					GameMode->OnPickupAvailabilityChanged(this);
+				}
+
 				if (RespawnTime > 0.0f)
 				{
 					GetWorldTimerManager().SetTimer(TimerHandle_RespawnPickup, this, &AShooterPickup::RespawnPickup, RespawnTime, false);
@@ -85,6 +111,11 @@ void AShooterPickup::RespawnPickup()
 	PickedUpBy = NULL;
 	OnRespawned();
 
+	if (AShooterGameMode* GameMode = GetWorld()->GetAuthGameMode<AShooterGameMode>())
+	{
+		GameMode->OnPickupAvailabilityChanged(this);
+	}
+
 	TSet<AActor*> OverlappingPawns;
 	GetOverlappingActors(OverlappingPawns, AShooterCharacter::StaticClass());
 
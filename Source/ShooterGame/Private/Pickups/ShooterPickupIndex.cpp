@@ -0,0 +1,141 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "Pickups/ShooterPickupIndex.h"
+#include "Pickups/ShooterPickup.h"
+#include "Algo/BinarySearch.h"
+
+namespace ShooterPickupIndex
+{
+	/** pickups are sparse, so cells are large; a bot typically searches a handful of them */
+	const float CellSize = 2000.0f;
+}
+
+FIntPoint FShooterPickupIndex::GetCell(const FVector& Location)
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / ShooterPickupIndex::CellSize), FMath::FloorToInt(Location.Y / ShooterPickupIndex::CellSize));
+}
+
+void FShooterPickupIndex::UpdatePickup(AShooterPickup* Pickup, bool bAvailable)
+{
+	RemovePickup(Pickup);
+
+	if (Pickup && bAvailable)
+	{
+		const UClass* CategoryClass = Pickup->GetPickupCategory();
+		const FIntPoint Cell = GetCell(Pickup->GetActorLocation());
+
+		FCategory& Category = Categories.FindOrAdd(CategoryClass);
+		Category.Cells.FindOrAdd(Cell).Add(Pickup);
+		Category.MinCell = FIntPoint(FMath::Min(Category.MinCell.X, Cell.X), FMath::Min(Category.MinCell.Y, Cell.Y));
+		Category.MaxCell = FIntPoint(FMath::Max(Category.MaxCell.X, Cell.X), FMath::Max(Category.MaxCell.Y, Cell.Y));
+
+		IndexedPickups.Add(Pickup, TPair<const UClass*, FIntPoint>(CategoryClass, Cell));
+	}
+}
+
+void FShooterPickupIndex::RemovePickup(AShooterPickup* Pickup)
+{
+	TPair<const UClass*, FIntPoint> Location;
+	if (IndexedPickups.RemoveAndCopyValue(Pickup, Location))
+	{
+		if (FCategory* Category = Categories.Find(Location.Key))
+		{
+			if (TArray<AShooterPickup*>* CellPickups = Category->Cells.Find(Location.Value))
+			{
+				CellPickups->RemoveSingleSwap(Pickup, false);
+			}
+		}
+	}
+}
+
+void FShooterPickupIndex::FindNearest(const UClass* CategoryClass, const FVector& Origin, int32 MaxCandidates, TFunctionRef<bool(AShooterPickup*)> Filter, TArray<FCandidate>& OutCandidates) const
+{
+	OutCandidates.Reset();
+	if (MaxCandidates <= 0)
+	{
+		return;
+	}
+
+	const FIntPoint OriginCell = GetCell(Origin);
+
+	// few categories exist (one per pickup class or ammo type), so checking each is cheap
+	for (const TPair<const UClass*, FCategory>& CategoryPair : Categories)
+	{
+		if (!CategoryPair.Key->IsChildOf(CategoryClass))
+		{
+			continue;
+		}
+
+		const FCategory& Category = CategoryPair.Value;
+		if (Category.MinCell.X > Category.MaxCell.X)
+		{
+			continue;
+		}
+
+		// search rings of cells outwards until nothing closer than the current candidates can remain
+		const int32 MaxRing = FMath::Max(
+			FMath::Max(FMath::Abs(OriginCell.X - Category.MinCell.X), FMath::Abs(OriginCell.X - Category.MaxCell.X)),
+			FMath::Max(FMath::Abs(OriginCell.Y - Category.MinCell.Y), FMath::Abs(OriginCell.Y - Category.MaxCell.Y)));
+
+		for (int32 Ring = 0; Ring <= MaxRing; Ring++)
+		{
+			if (OutCandidates.Num() == MaxCandidates)
+			{
+				// everything in this ring is at least (Ring - 1) cells away horizontally
+				const float MinRingDist = (Ring - 1) * ShooterPickupIndex::CellSize;
+				if (MinRingDist > 0.0f && FMath::Square(MinRingDist) > OutCandidates.Last().DistSq)
+				{
+					break;
+				}
+			}
+
+			if (Ring == 0)
+			{
+				GatherCell(Category, OriginCell, Origin, MaxCandidates, Filter, OutCandidates);
+				continue;
+			}
+
+			for (int32 Offset = -Ring; Offset <= Ring; Offset++)
+			{
+				GatherCell(Category, OriginCell + FIntPoint(Offset, -Ring), Origin, MaxCandidates, Filter, OutCandidates);
+				GatherCell(Category, OriginCell + FIntPoint(Offset, Ring), Origin, MaxCandidates, Filter, OutCandidates);
+			}
+			for (int32 Offset = -Ring + 1; Offset <= Ring - 1; Offset++)
+			{
+				GatherCell(Category, OriginCell + FIntPoint(-Ring, Offset), Origin, MaxCandidates, Filter, OutCandidates);
+				GatherCell(Category, OriginCell + FIntPoint(Ring, Offset), Origin, MaxCandidates, Filter, OutCandidates);
+			}
+		}
+	}
+}
+
+void FShooterPickupIndex::GatherCell(const FCategory& Category, const FIntPoint& Cell, const FVector& Origin, int32 MaxCandidates, TFunctionRef<bool(AShooterPickup*)> Filter, TArray<FCandidate>& OutCandidates)
+{
+	const TArray<AShooterPickup*>* CellPickups = Category.Cells.Find(Cell);
+	if (CellPickups == nullptr)
+	{
+		return;
+	}
+
+	for (AShooterPickup* Pickup : *CellPickups)
+	{
+		const float DistSq = (Pickup->GetActorLocation() - Origin).SizeSquared();
+		if (OutCandidates.Num() == MaxCandidates && DistSq >= OutCandidates.Last().DistSq)
+		{
+			continue;
+		}
+
+		if (!Filter(Pickup))
+		{
+			continue;
+		}
+
+		const int32 InsertIndex = Algo::LowerBoundBy(OutCandidates, DistSq, &FCandidate::DistSq);
+		OutCandidates.Insert(FCandidate{ Pickup, DistSq }, InsertIndex);
+		if (OutCandidates.Num() > MaxCandidates)
+		{
+			OutCandidates.Pop(false);
+		}
+	}
+}
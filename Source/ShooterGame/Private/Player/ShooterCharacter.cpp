@@ -8,7 +8,8 @@
 #include "Animation/AnimMontage.h"
 #include "Animation/AnimInstance.h"
 #include "Sound/SoundNodeLocalPlayer.h"
-#include "AudioThread.h"
+#include "Weapons/ShooterLagCompensation.h"
+#include "AcousticsStimulusBus.h"
 
 static int32 NetVisualizeRelevancyTestPoints = 0;
 FAutoConsoleVariableRef CVarNetVisualizeRelevancyTestPoints(
@@ -27,6 +28,20 @@ FAutoConsoleVariableRef CVarNetEnablePauseRelevancy(
 	TEXT("0: Disable, 1: Enable"),
 	ECVF_Cheat);
 
+static float NetPauseRelevancyCacheTime = 0.2f;
+FAutoConsoleVariableRef CVarNetPauseRelevancyCacheTime(
+	TEXT("p.NetPauseRelevancyCacheTime"),
+	NetPauseRelevancyCacheTime,
+	TEXT("How long in seconds a pause replication occlusion result is reused before it is traced again."),
+	ECVF_Cheat);
+
+static float NetPauseRelevancyViewCellSize = 50.0f;
+FAutoConsoleVariableRef CVarNetPauseRelevancyViewCellSize(
+	TEXT("p.NetPauseRelevancyViewCellSize"),
+	NetPauseRelevancyViewCellSize,
+	TEXT("Size in cm of the grid view locations are snapped to. Connections viewing from the same cell share occlusion results."),
+	ECVF_Cheat);
+
 FOnShooterCharacterEquipWeapon AShooterCharacter::NotifyEquipWeapon;
 FOnShooterCharacterUnEquipWeapon AShooterCharacter::NotifyUnEquipWeapon;
 
@@ -67,6 +82,9 @@ AShooterCharacter::AShooterCharacter(const FObjectInitializer& ObjectInitializer
 
 	BaseTurnRate = 45.f;
 	BaseLookUpRate = 45.f;
+
+	NextPauseRelevancyEntryId = 0;
+	PauseRelevancyTraceDelegate.BindUObject(this, &AShooterCharacter::OnPauseRelevancyTraceDone);
 }
 
 void AShooterCharacter::PostInitializeComponents()
@@ -77,6 +95,13 @@ void AShooterCharacter::PostInitializeComponents()
 	{
 		Health = GetMaxHealth();
 
+		// remote clients' hits on us are validated against our recorded poses
+		UShooterLagCompensation* LagCompensation = GetWorld()->GetSubsystem<UShooterLagCompensation>();
+		if (LagCompensation && GetNetMode() != NM_Standalone)
+		{
+			LagCompensation->RegisterCharacter(this);
+		}
+
 		// Needs to happen after character is added to repgraph
 		GetWorldTimerManager().SetTimerForNextTick(this, &AShooterCharacter::SpawnDefaultInventory);
 	}
@@ -109,6 +134,11 @@ void AShooterCharacter::Destroyed()
 {
 	Super::Destroyed();
 	DestroyInventory();
+
+	if (UShooterLagCompensation* LagCompensation = GetWorld()->GetSubsystem<UShooterLagCompensation>())
+	{
+		LagCompensation->UnregisterCharacter(this);
+	}
 }
 
 void AShooterCharacter::PawnClientRestart()
@@ -124,6 +154,8 @@ void AShooterCharacter::PawnClientRestart()
 	// set team colors for 1st person view
 	UMaterialInstanceDynamic* Mesh1PMID = Mesh1P->CreateAndSetMaterialInstanceDynamic(0);
 	UpdateTeamColors(Mesh1PMID);
+
+	UpdateLocalPlayerSoundState();
 }
 
 void AShooterCharacter::PossessedBy(class AController* InController)
@@ -132,6 +164,29 @@ void AShooterCharacter::PossessedBy(class AController* InController)
 
 	// [server] as soon as PlayerState is assigned, set team colors of this pawn for local player
 	UpdateTeamColorsAllMIDs();
+
+	UpdateLocalPlayerSoundState();
+}
+
+void AShooterCharacter::UnPossessed()
+{
+	Super::UnPossessed();
+
+	UpdateLocalPlayerSoundState();
+}
+
+void AShooterCharacter::OnRep_Controller()
+{
+	Super::OnRep_Controller();
+
+	UpdateLocalPlayerSoundState();
+}
+
+void AShooterCharacter::UpdateLocalPlayerSoundState()
+{
+	const APlayerController* PC = Cast<APlayerController>(GetController());
+	const bool bLocallyControlled = (PC ? PC->IsLocalController() : false);
+	USoundNodeLocalPlayer::SetLocallyControlledActor(GetUniqueID(), bLocallyControlled);
 }
 
 void AShooterCharacter::OnRep_PlayerState()
@@ -284,7 +339,10 @@ float AShooterCharacter::TakeDamage(float Damage, struct FDamageEvent const& Dam
 			PlayHit(ActualDamage, DamageEvent, EventInstigator ? EventInstigator->GetPawn() : NULL, DamageCauser);
 		}
 
-		MakeNoise(1.0f, EventInstigator ? EventInstigator->GetPawn() : this);
+		APawn* NoiseInstigator = EventInstigator ? EventInstigator->GetPawn() : this;
+		MakeNoise(1.0f, NoiseInstigator);
+		// full loudness noise, 0 dB for AI listeners
+		FAcousticsStimulusBus::Get().Post(GetActorLocation(), 0.0f, NoiseInstigator);
 	}
 
 	return ActualDamage;
@@ -1095,19 +1153,11 @@ void AShooterCharacter::Tick(float DeltaSeconds)
 		UpdateRunSounds();
 	}
 
-	const APlayerController* PC = Cast<APlayerController>(GetController());
-	const bool bLocallyControlled = (PC ? PC->IsLocalController() : false);
-	const uint32 UniqueID = GetUniqueID();
-	FAudioThread::RunCommandOnAudioThread([UniqueID, bLocallyControlled]()
-	{
-	    USoundNodeLocalPlayer::GetLocallyControlledActorCache().Add(UniqueID, bLocallyControlled);
-	});
-	
-	TArray<FVector> PointsToTest;
-	BuildPauseReplicationCheckPoints(PointsToTest);
-
 	if (NetVisualizeRelevancyTestPoints == 1)
 	{
+		TArray<FVector> PointsToTest;
+		BuildPauseReplicationCheckPoints(PointsToTest);
+
 		for (FVector PointToTest : PointsToTest)
 		{
 			DrawDebugSphere(GetWorld(), PointToTest, 10.0f, 8, FColor::Red);
@@ -1121,11 +1171,7 @@ void AShooterCharacter::BeginDestroy()
 
 	if (!GExitPurge)
 	{
-		const uint32 UniqueID = GetUniqueID();
-		FAudioThread::RunCommandOnAudioThread([UniqueID]()
-		{
-			USoundNodeLocalPlayer::GetLocallyControlledActorCache().Remove(UniqueID);
-		});
+		USoundNodeLocalPlayer::SetLocallyControlledActor(GetUniqueID(), false);
 	}
 }
 
@@ -1184,26 +1230,86 @@ bool AShooterCharacter::IsReplicationPausedForConnection(const FNetViewer& Conne
 		FRotator ViewRotation;
 		PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
 
-		FCollisionQueryParams CollisionParams(SCENE_QUERY_STAT(LineOfSight), true, PC->GetPawn());
-		CollisionParams.AddIgnoredActor(this);
+		const float CellSize = FMath::Max(NetPauseRelevancyViewCellSize, 1.0f);
+		const FIntVector ViewCell(
+			FMath::FloorToInt(ViewLocation.X / CellSize),
+			FMath::FloorToInt(ViewLocation.Y / CellSize),
+			FMath::FloorToInt(ViewLocation.Z / CellSize));
+		const float CurrentTime = GetWorld()->GetTimeSeconds();
 
-		TArray<FVector> PointsToTest;
-		BuildPauseReplicationCheckPoints(PointsToTest);
+		FPauseRelevancyEntry* Entry = PauseRelevancyCache.FindByPredicate([&ViewCell](const FPauseRelevancyEntry& Candidate)
+		{
+			return Candidate.ViewCell == ViewCell;
+		});
 
-		for (FVector PointToTest : PointsToTest)
+		if (!Entry)
 		{
-			if (!GetWorld()->LineTraceTestByChannel(PointToTest, ViewLocation, ECC_Visibility, CollisionParams))
+			// Forget viewpoints nobody has asked about for a while before adding a new one
+			PauseRelevancyCache.RemoveAllSwap([CurrentTime](const FPauseRelevancyEntry& Candidate)
 			{
-				return false;
-			}
+				return Candidate.PendingTraces == 0 && CurrentTime - Candidate.Time > NetPauseRelevancyCacheTime * 4.0f;
+			});
+
+			Entry = &PauseRelevancyCache.AddZeroed_GetRef();
+			Entry->ViewCell = ViewCell;
+			Entry->Id = NextPauseRelevancyEntryId++;
+			Entry->Time = CurrentTime;
 		}
 
-		return true;
+		const bool bStale = !Entry->bHasResult || CurrentTime - Entry->Time > NetPauseRelevancyCacheTime;
+		if (bStale && Entry->PendingTraces == 0)
+		{
+			RequestPauseRelevancyTraces(*Entry, ViewLocation, PC->GetPawn());
+		}
+
+		// Until the first batch reports back, keep replicating rather than risk hiding a visible pawn
+		return Entry->bHasResult && !Entry->bVisible;
 	}
 
 	return false;
 }
 
+void AShooterCharacter::RequestPauseRelevancyTraces(FPauseRelevancyEntry& Entry, const FVector& ViewLocation, const APawn* ViewPawn)
+{
+	FCollisionQueryParams CollisionParams(SCENE_QUERY_STAT(LineOfSight), true, ViewPawn);
+	CollisionParams.AddIgnoredActor(this);
+
+	TArray<FVector> PointsToTest;
+	BuildPauseReplicationCheckPoints(PointsToTest);
+
+	// The traces are batched with the rest of the frame's async traces and run in parallel at the end of the frame
+	Entry.PendingTraces = PointsToTest.Num();
+	Entry.bAnyVisibleInBatch = false;
+	for (const FVector& PointToTest : PointsToTest)
+	{
+		GetWorld()->AsyncLineTraceByChannel(EAsyncTraceType::Test, PointToTest, ViewLocation, ECC_Visibility, CollisionParams,
+			FCollisionResponseParams::DefaultResponseParam, &PauseRelevancyTraceDelegate, Entry.Id);
+	}
+}
+
+void AShooterCharacter::OnPauseRelevancyTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	FPauseRelevancyEntry* Entry = PauseRelevancyCache.FindByPredicate([&TraceDatum](const FPauseRelevancyEntry& Candidate)
+	{
+		return Candidate.Id == TraceDatum.UserData;
+	});
+
+	if (!Entry || Entry->PendingTraces == 0)
+	{
+		return;
+	}
+
+	const bool bBlocked = TraceDatum.OutHits.Num() > 0 && TraceDatum.OutHits[0].bBlockingHit;
+	Entry->bAnyVisibleInBatch |= !bBlocked;
+
+	if (--Entry->PendingTraces == 0)
+	{
+		Entry->bVisible = Entry->bAnyVisibleInBatch;
+		Entry->bHasResult = true;
+		Entry->Time = GetWorld() ? GetWorld()->GetTimeSeconds() : Entry->Time;
+	}
+}
+
 void AShooterCharacter::OnReplicationPausedChanged(bool bIsReplicationPaused)
 {
 	GetMesh()->SetHiddenInGame(bIsReplicationPaused, true);
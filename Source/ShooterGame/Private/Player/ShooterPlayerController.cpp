@@ -20,7 +20,6 @@
 #include "ShooterLeaderboards.h"
 #include "ShooterGameViewportClient.h"
 #include "Sound/SoundNodeLocalPlayer.h"
-#include "AudioThread.h"
 #include "OnlineSubsystemUtils.h"
 
 #define  ACH_FRAG_SOMEONE	TEXT("ACH_FRAG_SOMEONE")
@@ -152,13 +151,6 @@ void AShooterPlayerController::TickActor(float DeltaTime, enum ELevelTick TickTy
 			}
 		}
 	}
-
-	const bool bLocallyControlled = IsLocalController();
-	const uint32 UniqueID = GetUniqueID();
-	FAudioThread::RunCommandOnAudioThread([UniqueID, bLocallyControlled]()
-	{
-		USoundNodeLocalPlayer::GetLocallyControlledActorCache().Add(UniqueID, bLocallyControlled);
-	});
 };
 
 void AShooterPlayerController::BeginDestroy()
@@ -171,11 +163,7 @@ void AShooterPlayerController::BeginDestroy()
 
 	if (!GExitPurge)
 	{
-		const uint32 UniqueID = GetUniqueID();
-		FAudioThread::RunCommandOnAudioThread([UniqueID]()
-		{
-			USoundNodeLocalPlayer::GetLocallyControlledActorCache().Remove(UniqueID);
-		});
+		USoundNodeLocalPlayer::SetLocallyControlledActor(GetUniqueID(), false);
 	}
 }
 
@@ -192,6 +180,8 @@ void AShooterPlayerController::SetPlayer( UPlayer* InPlayer )
 		FInputModeGameOnly InputMode;
 		SetInputMode(InputMode);
 	}
+
+	USoundNodeLocalPlayer::SetLocallyControlledActor(GetUniqueID(), IsLocalController());
 }
 
 void AShooterPlayerController::QueryAchievements()
@@ -3,23 +3,62 @@
 #include "ShooterGame.h"
 #include "Sound/SoundNodeLocalPlayer.h"
 #include "SoundDefinitions.h"
+#include "AudioThread.h"
 
 #define LOCTEXT_NAMESPACE "SoundNodeLocalPlayer"
 
-TMap<uint32, bool> USoundNodeLocalPlayer::LocallyControlledActorCache;
+DECLARE_DWORD_COUNTER_STAT(TEXT("Local Player Audio Commands"), STAT_LocalPlayerAudioCommands, STATGROUP_Audio);
+
+USoundNodeLocalPlayer::FLocallyControlledActorList USoundNodeLocalPlayer::GameThreadLocallyControlledActors;
+USoundNodeLocalPlayer::FLocallyControlledActorList USoundNodeLocalPlayer::LocallyControlledActors;
 
 USoundNodeLocalPlayer::USoundNodeLocalPlayer(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 }
 
-void USoundNodeLocalPlayer::ParseNodes(FAudioDevice* AudioDevice, const UPTRINT NodeWaveInstanceHash, FActiveSound& ActiveSound, const FSoundParseParameters& ParseParams, TArray<FWaveInstance*>& WaveInstances)
+void USoundNodeLocalPlayer::SetLocallyControlledActor(uint32 ActorID, bool bLocallyControlled)
 {
-	bool bLocallyControlled = false;
-	if (bool* LocallyControlledPtr = LocallyControlledActorCache.Find(ActiveSound.GetOwnerID()))
+	check(IsInGameThread());
+
+	const bool bWasLocallyControlled = GameThreadLocallyControlledActors.Contains(ActorID);
+	if (bWasLocallyControlled == bLocallyControlled)
 	{
-		bLocallyControlled = *LocallyControlledPtr;
+		return;
 	}
 
+	if (bLocallyControlled)
+	{
+		GameThreadLocallyControlledActors.Add(ActorID);
+	}
+	else
+	{
+		GameThreadLocallyControlledActors.RemoveSwap(ActorID);
+	}
+
+	INC_DWORD_STAT(STAT_LocalPlayerAudioCommands);
+	FAudioThread::RunCommandOnAudioThread([ActorID, bLocallyControlled]()
+	{
+		if (bLocallyControlled)
+		{
+			LocallyControlledActors.AddUnique(ActorID);
+		}
+		else
+		{
+			LocallyControlledActors.RemoveSwap(ActorID);
+		}
+	});
+}
+
+bool USoundNodeLocalPlayer::IsLocallyControlledActor(uint32 ActorID)
+{
+	check(IsInAudioThread());
+	return LocallyControlledActors.Contains(ActorID);
+}
+
+void USoundNodeLocalPlayer::ParseNodes(FAudioDevice* AudioDevice, const UPTRINT NodeWaveInstanceHash, FActiveSound& ActiveSound, const FSoundParseParameters& ParseParams, TArray<FWaveInstance*>& WaveInstances)
+{
+	const bool bLocallyControlled = IsLocallyControlledActor(ActiveSound.GetOwnerID());
+
 	const int32 PlayIndex = bLocallyControlled ? 0 : 1;
 
 	if (PlayIndex < ChildNodes.Num() && ChildNodes[PlayIndex])
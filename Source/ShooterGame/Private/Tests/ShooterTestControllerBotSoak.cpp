@@ -0,0 +1,292 @@
+// Copyright Epic Games, Inc.All Rights Reserved.
+#include "Tests/ShooterTestControllerBotSoak.h"
+#include "ShooterGame.h"
+#include "Bots/ShooterAIController.h"
+#include "AcousticsSecondaryListener.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+namespace BotSoak
+{
+	/** one bucket per ms of game thread time, plus one for everything slower */
+	const int32 NumHistogramBuckets = 101;
+
+	/** how often to look for bot pawns that respawned without ears */
+	const double ListenerScanInterval = 1.0;
+
+	/** how long to wait for the server to get into a game before giving up */
+	const double MaxTimeToGame = 300.0;
+
+	const double BytesPerMB = 1024.0 * 1024.0;
+}
+
+void UShooterTestControllerBotSoak::OnInit()
+{
+	Super::OnInit();
+
+	if (!FParse::Value(FCommandLine::Get(), TEXT("SoakBots="), NumBots))
+	{
+		NumBots = 32;
+	}
+	bAttachAcousticListeners = FParse::Param(FCommandLine::Get(), TEXT("SoakAcousticListeners"));
+
+	if (!FParse::Value(FCommandLine::Get(), TEXT("SoakWarmupSeconds="), WarmupSeconds))
+	{
+		WarmupSeconds = 10.0f;
+	}
+	if (!FParse::Value(FCommandLine::Get(), TEXT("SoakDurationSeconds="), DurationSeconds))
+	{
+		DurationSeconds = 300.0f;
+	}
+
+	MaxAvgFrameMs = 0.0f;
+	MaxP99FrameMs = 0.0f;
+	MaxMemoryMB = 0.0f;
+	FParse::Value(FCommandLine::Get(), TEXT("SoakMaxAvgFrameMs="), MaxAvgFrameMs);
+	FParse::Value(FCommandLine::Get(), TEXT("SoakMaxP99FrameMs="), MaxP99FrameMs);
+	FParse::Value(FCommandLine::Get(), TEXT("SoakMaxMemoryMB="), MaxMemoryMB);
+
+	bInGame = false;
+	bMeasuring = false;
+	bFinished = false;
+	InGameStartTime = 0.0;
+	MeasureStartTime = 0.0;
+	LastListenerScanTime = 0.0;
+	NumListenersAttached = 0;
+
+	GameThreadHistogram.Reset();
+	GameThreadHistogram.AddZeroed(BotSoak::NumHistogramBuckets);
+	NumFrames = 0;
+	TotalGameThreadMs = 0.0;
+	TotalFrameMs = 0.0;
+	MaxGameThreadMs = 0.0f;
+	MaxFrameMs = 0.0f;
+	MaxUsedPhysical = 0;
+	MaxUsedVirtual = 0;
+
+	UE_LOG(LogGauntlet, Display, TEXT("Bot soak: %d bots, acoustic listeners %s, %.0fs warmup, %.0fs measured"),
+		NumBots, bAttachAcousticListeners ? TEXT("on") : TEXT("off"), WarmupSeconds, DurationSeconds);
+}
+
+void UShooterTestControllerBotSoak::OnPostMapChange(UWorld* World)
+{
+	// Matches restart the map, so this runs again for every round; bots are only ever added up to NumBots
+	if (World && World->GetAuthGameMode<AShooterGameMode>())
+	{
+		SetupBots(World);
+
+		if (!bInGame)
+		{
+			bInGame = true;
+			InGameStartTime = FPlatformTime::Seconds();
+		}
+	}
+}
+
+void UShooterTestControllerBotSoak::OnTick(float TimeDelta)
+{
+	if (bFinished)
+	{
+		return;
+	}
+
+	if (!bInGame)
+	{
+		if (GetTimeInCurrentState() > BotSoak::MaxTimeToGame)
+		{
+			UE_LOG(LogGauntlet, Error, TEXT("Failing bot soak, server was not in a game after %.0f secs!"), BotSoak::MaxTimeToGame);
+			EndTest(-1);
+		}
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+
+	if (bAttachAcousticListeners && Now - LastListenerScanTime >= BotSoak::ListenerScanInterval)
+	{
+		LastListenerScanTime = Now;
+		AttachAcousticListeners(GetWorld());
+	}
+
+	if (!bMeasuring)
+	{
+		if (Now - InGameStartTime >= WarmupSeconds)
+		{
+			bMeasuring = true;
+			MeasureStartTime = Now;
+
+#if CSV_PROFILER
+			// Per-category timings for the same window, written by the CSV profiler next to our summary
+			if (!FCsvProfiler::Get()->IsCapturing())
+			{
+				FCsvProfiler::Get()->BeginCapture();
+			}
+#endif
+		}
+		return;
+	}
+
+	RecordFrame(TimeDelta);
+
+	if (Now - MeasureStartTime >= DurationSeconds)
+	{
+		FinishSoak();
+	}
+}
+
+void UShooterTestControllerBotSoak::SetupBots(UWorld* World)
+{
+	AShooterGameMode* GameMode = World->GetAuthGameMode<AShooterGameMode>();
+	GameMode->SetAllowBots(NumBots > 0, NumBots);
+	GameMode->CreateBotControllers();
+
+	// Bots are normally spawned when the match starts; if it already has, spawn the new ones now
+	if (GameMode->IsMatchInProgress())
+	{
+		for (FConstControllerIterator It = World->GetControllerIterator(); It; ++It)
+		{
+			AShooterAIController* AIC = Cast<AShooterAIController>(*It);
+			if (AIC && AIC->GetPawn() == nullptr)
+			{
+				GameMode->RestartPlayer(AIC);
+			}
+		}
+	}
+}
+
+void UShooterTestControllerBotSoak::AttachAcousticListeners(UWorld* World)
+{
+	if (World == nullptr)
+	{
+		return;
+	}
+
+	for (FConstControllerIterator It = World->GetControllerIterator(); It; ++It)
+	{
+		AShooterAIController* AIC = Cast<AShooterAIController>(*It);
+		APawn* Pawn = AIC ? AIC->GetPawn() : nullptr;
+		if (Pawn && Pawn->FindComponentByClass<UAcousticsSecondaryListener>() == nullptr)
+		{
+			UAcousticsSecondaryListener* Listener = NewObject<UAcousticsSecondaryListener>(Pawn);
+			Listener->ListenToStimuli = true;
+			Listener->RegisterComponent();
+			NumListenersAttached++;
+		}
+	}
+}
+
+void UShooterTestControllerBotSoak::RecordFrame(float TimeDelta)
+{
+	// Game thread time excludes the idle wait for the server tick rate, so it reflects actual load
+	const float GameThreadMs = FPlatformTime::ToMilliseconds(GGameThreadTime);
+	const float FrameMs = TimeDelta * 1000.0f;
+
+	const int32 Bucket = FMath::Clamp(FMath::FloorToInt(GameThreadMs), 0, GameThreadHistogram.Num() - 1);
+	GameThreadHistogram[Bucket]++;
+	NumFrames++;
+	TotalGameThreadMs += GameThreadMs;
+	TotalFrameMs += FrameMs;
+	MaxGameThreadMs = FMath::Max(MaxGameThreadMs, GameThreadMs);
+	MaxFrameMs = FMath::Max(MaxFrameMs, FrameMs);
+
+	const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+	MaxUsedPhysical = FMath::Max<uint64>(MaxUsedPhysical, MemoryStats.UsedPhysical);
+	MaxUsedVirtual = FMath::Max<uint64>(MaxUsedVirtual, MemoryStats.UsedVirtual);
+}
+
+float UShooterTestControllerBotSoak::GetFrameTimePercentile(float Percentile) const
+{
+	const int32 TargetCount = FMath::CeilToInt(NumFrames * Percentile);
+	int32 Count = 0;
+	for (int32 Bucket = 0; Bucket < GameThreadHistogram.Num(); Bucket++)
+	{
+		Count += GameThreadHistogram[Bucket];
+		if (Count >= TargetCount)
+		{
+			// Upper edge of the bucket; the overflow bucket reports the slowest frame instead
+			return Bucket == GameThreadHistogram.Num() - 1 ? MaxGameThreadMs : Bucket + 1.0f;
+		}
+	}
+	return MaxGameThreadMs;
+}
+
+void UShooterTestControllerBotSoak::FinishSoak()
+{
+	bFinished = true;
+
+#if CSV_PROFILER
+	if (FCsvProfiler::Get()->IsCapturing())
+	{
+		FCsvProfiler::Get()->EndCapture();
+	}
+#endif
+
+	const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+	const float AvgGameThreadMs = NumFrames > 0 ? TotalGameThreadMs / NumFrames : 0.0f;
+	const float AvgFrameMs = NumFrames > 0 ? TotalFrameMs / NumFrames : 0.0f;
+	const float P50GameThreadMs = GetFrameTimePercentile(0.5f);
+	const float P99GameThreadMs = GetFrameTimePercentile(0.99f);
+	const float MaxUsedPhysicalMB = MaxUsedPhysical / BotSoak::BytesPerMB;
+
+	FString Csv = TEXT("Metric,Value\n");
+	Csv += FString::Printf(TEXT("Bots,%d\n"), NumBots);
+	Csv += FString::Printf(TEXT("AcousticListeners,%d\n"), NumListenersAttached);
+	Csv += FString::Printf(TEXT("DurationSeconds,%.1f\n"), DurationSeconds);
+	Csv += FString::Printf(TEXT("Frames,%d\n"), NumFrames);
+	Csv += FString::Printf(TEXT("AvgGameThreadMs,%.3f\n"), AvgGameThreadMs);
+	Csv += FString::Printf(TEXT("P50GameThreadMs,%.3f\n"), P50GameThreadMs);
+	Csv += FString::Printf(TEXT("P99GameThreadMs,%.3f\n"), P99GameThreadMs);
+	Csv += FString::Printf(TEXT("MaxGameThreadMs,%.3f\n"), MaxGameThreadMs);
+	Csv += FString::Printf(TEXT("AvgFrameMs,%.3f\n"), AvgFrameMs);
+	Csv += FString::Printf(TEXT("MaxFrameMs,%.3f\n"), MaxFrameMs);
+	Csv += FString::Printf(TEXT("MaxUsedPhysicalMB,%.1f\n"), MaxUsedPhysicalMB);
+	Csv += FString::Printf(TEXT("PeakUsedPhysicalMB,%.1f\n"), MemoryStats.PeakUsedPhysical / BotSoak::BytesPerMB);
+	Csv += FString::Printf(TEXT("MaxUsedVirtualMB,%.1f\n"), MaxUsedVirtual / BotSoak::BytesPerMB);
+	Csv += FString::Printf(TEXT("PeakUsedVirtualMB,%.1f\n"), MemoryStats.PeakUsedVirtual / BotSoak::BytesPerMB);
+
+	Csv += TEXT("\nGameThreadMs,Frames\n");
+	for (int32 Bucket = 0; Bucket < GameThreadHistogram.Num(); Bucket++)
+	{
+		if (GameThreadHistogram[Bucket] > 0)
+		{
+			const bool bOverflow = Bucket == GameThreadHistogram.Num() - 1;
+			Csv += FString::Printf(TEXT("%s%d,%d\n"), bOverflow ? TEXT(">=") : TEXT(""), Bucket, GameThreadHistogram[Bucket]);
+		}
+	}
+
+	const FString CsvPath = FPaths::Combine(FPaths::ProfilingDir(), TEXT("BotSoak"), FString::Printf(TEXT("BotSoak_%s.csv"), *FDateTime::Now().ToString()));
+	if (FFileHelper::SaveStringToFile(Csv, *CsvPath))
+	{
+		UE_LOG(LogGauntlet, Display, TEXT("Bot soak results written to %s"), *CsvPath);
+	}
+	else
+	{
+		UE_LOG(LogGauntlet, Warning, TEXT("Failed to write bot soak results to %s"), *CsvPath);
+	}
+
+	UE_LOG(LogGauntlet, Display, TEXT("Bot soak: %d frames, game thread avg %.2fms p99 %.2fms max %.2fms, max used physical %.1fMB"),
+		NumFrames, AvgGameThreadMs, P99GameThreadMs, MaxGameThreadMs, MaxUsedPhysicalMB);
+
+	bool bFailed = false;
+	if (NumFrames == 0)
+	{
+		UE_LOG(LogGauntlet, Error, TEXT("Failed!  No frames were measured!"));
+		bFailed = true;
+	}
+	if (MaxAvgFrameMs > 0.0f && AvgGameThreadMs > MaxAvgFrameMs)
+	{
+		UE_LOG(LogGauntlet, Error, TEXT("Failed!  Average game thread time %.2fms is over budget (%.2fms)!"), AvgGameThreadMs, MaxAvgFrameMs);
+		bFailed = true;
+	}
+	if (MaxP99FrameMs > 0.0f && P99GameThreadMs > MaxP99FrameMs)
+	{
+		UE_LOG(LogGauntlet, Error, TEXT("Failed!  99th percentile game thread time %.2fms is over budget (%.2fms)!"), P99GameThreadMs, MaxP99FrameMs);
+		bFailed = true;
+	}
+	if (MaxMemoryMB > 0.0f && MaxUsedPhysicalMB > MaxMemoryMB)
+	{
+		UE_LOG(LogGauntlet, Error, TEXT("Failed!  Used physical memory %.1fMB is over budget (%.1fMB)!"), MaxUsedPhysicalMB, MaxMemoryMB);
+		bFailed = true;
+	}
+
+	EndTest(bFailed ? -1 : 0);
+}
@@ -27,6 +27,7 @@ void SShooterScoreboardWidget::Construct(const FArguments& InArgs)
 
 	ScoreboardStartTime = FPlatformTime::Seconds();
 	MatchState = InArgs._MatchState.Get();
+	RankedMapVersion = 0;
 
 	UpdatePlayerStateMaps();
 	
@@ -281,8 +282,11 @@ void SShooterScoreboardWidget::UpdatePlayerStateMaps()
 	if (PCOwner.IsValid())
 	{
 		AShooterGameState* const GameState = PCOwner->GetWorld()->GetGameState<AShooterGameState>();
-		if (GameState)
+		if (GameState && (GameState != RankedMapSource.Get() || GameState->GetRankedMapVersion() != RankedMapVersion))
 		{
+			RankedMapSource = GameState;
+			RankedMapVersion = GameState->GetRankedMapVersion();
+
 			bool bRequiresWidgetUpdate = false;
 			const int32 NumTeams = FMath::Max(GameState->NumTeams, 1);
 			LastTeamPlayerCount.Reset();
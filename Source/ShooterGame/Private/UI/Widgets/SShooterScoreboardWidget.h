@@ -219,9 +219,15 @@ protected:
 	/** the player currently selected in the scoreboard */
 	FTeamPlayer SelectedPlayer;
 
-	/** the Ranked PlayerState map...cleared every frame */
+	/** the Ranked PlayerState map...copied from the game state when its ranking changes */
 	TArray<RankedPlayerMap> PlayerStateMaps;
 
+	/** game state PlayerStateMaps was last copied from */
+	TWeakObjectPtr<AShooterGameState> RankedMapSource;
+
+	/** ranked map version of the game state when PlayerStateMaps was last copied */
+	uint32 RankedMapVersion;
+
 	/** player count in each team in the last tick */
 	TArray<int32> LastTeamPlayerCount;
 
@@ -0,0 +1,247 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "Weapons/ShooterLagCompensation.h"
+#include "Weapons/ShooterWeapon_Instant.h"
+
+DECLARE_STATS_GROUP(TEXT("ShooterLagCompensation"), STATGROUP_ShooterLagCompensation, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Record Poses"), STAT_ShooterLagCompRecord, STATGROUP_ShooterLagCompensation);
+DECLARE_CYCLE_STAT(TEXT("Validate Hits"), STAT_ShooterLagCompValidate, STATGROUP_ShooterLagCompensation);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Hits Confirmed"), STAT_ShooterLagCompHitsConfirmed, STATGROUP_ShooterLagCompensation);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Hits Rejected"), STAT_ShooterLagCompHitsRejected, STATGROUP_ShooterLagCompensation);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Tracked Characters"), STAT_ShooterLagCompTracked, STATGROUP_ShooterLagCompensation);
+
+static int32 LagCompensationEnable = 1;
+static FAutoConsoleVariableRef CVarLagCompensationEnable(
+	TEXT("p.LagCompensation.Enable"),
+	LagCompensationEnable,
+	TEXT("Validate client reported hits on characters against their pose at the time the client fired.\n")
+	TEXT("0: Use the current bounding box of the hit actor, 1: Enable"),
+	ECVF_Default);
+
+static float LagCompensationMaxRewindTime = 0.5f;
+static FAutoConsoleVariableRef CVarLagCompensationMaxRewindTime(
+	TEXT("p.LagCompensation.MaxRewindTime"),
+	LagCompensationMaxRewindTime,
+	TEXT("Maximum time (seconds) a hit may be rewound. Clients reporting older hits are validated against the oldest allowed pose."),
+	ECVF_Default);
+
+bool UShooterLagCompensation::IsEnabled()
+{
+	return LagCompensationEnable != 0;
+}
+
+void UShooterLagCompensation::Deinitialize()
+{
+	DEC_DWORD_STAT_BY(STAT_ShooterLagCompTracked, Histories.Num());
+
+	Histories.Empty();
+	HistoryIndices.Empty();
+	PendingHits.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UShooterLagCompensation::IsTickable() const
+{
+	return Histories.Num() > 0 || PendingHits.Num() > 0;
+}
+
+TStatId UShooterLagCompensation::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UShooterLagCompensation, STATGROUP_Tickables);
+}
+
+float UShooterLagCompensation::GetTimestamp(const UWorld* World)
+{
+	// on clients the replicated server time is not corrected for latency, so it lags the server by about as much
+	// as the replicated character positions do; that is the moment the shooter was actually aiming at
+	const AGameStateBase* GameState = World ? World->GetGameState() : nullptr;
+	return GameState ? GameState->GetServerWorldTimeSeconds() : (World ? World->GetTimeSeconds() : 0.0f);
+}
+
+void UShooterLagCompensation::RegisterCharacter(AShooterCharacter* Character)
+{
+	if (Character == nullptr || HistoryIndices.Contains(Character))
+	{
+		return;
+	}
+
+	const int32 Index = Histories.AddDefaulted();
+	FPoseHistory& History = Histories[Index];
+	History.Character = Character;
+	History.NumSamples = 0;
+	History.Newest = HistorySize - 1;
+	HistoryIndices.Add(Character, Index);
+
+	INC_DWORD_STAT(STAT_ShooterLagCompTracked);
+}
+
+void UShooterLagCompensation::UnregisterCharacter(AShooterCharacter* Character)
+{
+	int32 Index = INDEX_NONE;
+	if (!HistoryIndices.RemoveAndCopyValue(Character, Index))
+	{
+		return;
+	}
+
+	Histories.RemoveAtSwap(Index, 1, false);
+	if (Index < Histories.Num())
+	{
+		// fix up the history that was moved into the removed slot; its character may already be gone
+		for (TPair<const AShooterCharacter*, int32>& IndexPair : HistoryIndices)
+		{
+			if (IndexPair.Value == Histories.Num())
+			{
+				IndexPair.Value = Index;
+				break;
+			}
+		}
+	}
+
+	DEC_DWORD_STAT(STAT_ShooterLagCompTracked);
+}
+
+bool UShooterLagCompensation::IsCharacterTracked(const AShooterCharacter* Character) const
+{
+	const int32* Index = HistoryIndices.Find(Character);
+	return Index && Histories[*Index].NumSamples > 0;
+}
+
+void UShooterLagCompensation::QueueHitValidation(AShooterWeapon_Instant* Weapon, AShooterCharacter* Target, const FHitResult& Impact, const FVector& ShootDir, int32 RandomSeed, float ReticleSpread, float ClientTimestamp, float Tolerance)
+{
+	// never trust the client further than the allowed rewind window
+	const float Now = GetTimestamp(GetWorld());
+	const float Timestamp = FMath::Clamp(ClientTimestamp, Now - LagCompensationMaxRewindTime, Now);
+
+	FPendingHit& PendingHit = PendingHits.AddDefaulted_GetRef();
+	PendingHit.Weapon = Weapon;
+	PendingHit.Target = Target;
+	PendingHit.Impact = Impact;
+	PendingHit.ShootDir = ShootDir;
+	PendingHit.RandomSeed = RandomSeed;
+	PendingHit.ReticleSpread = ReticleSpread;
+	PendingHit.Timestamp = Timestamp;
+	PendingHit.Tolerance = Tolerance;
+}
+
+void UShooterLagCompensation::Tick(float DeltaTime)
+{
+	// validate before recording, the newest pose a hit can rewind to is the one from the previous frame
+	if (PendingHits.Num() > 0)
+	{
+		ValidatePendingHits();
+	}
+
+	if (Histories.Num() > 0)
+	{
+		RecordPoses(GetTimestamp(GetWorld()));
+	}
+}
+
+void UShooterLagCompensation::RecordPoses(float Timestamp)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ShooterLagCompRecord);
+
+	for (FPoseHistory& History : Histories)
+	{
+		const AShooterCharacter* Character = History.Character.Get();
+		if (Character == nullptr)
+		{
+			continue;
+		}
+
+		// time does not advance while paused, overwrite the newest pose instead of adding a duplicate
+		if (History.NumSamples == 0 || History.Samples[History.Newest].Time < Timestamp)
+		{
+			History.Newest = (History.Newest + 1) & (HistorySize - 1);
+			History.NumSamples = FMath::Min(History.NumSamples + 1, HistorySize);
+		}
+
+		const UCapsuleComponent* Capsule = Character->GetCapsuleComponent();
+		FPoseSample& Sample = History.Samples[History.Newest];
+		Sample.Center = Capsule->GetComponentLocation();
+		Sample.HalfHeight = Capsule->GetScaledCapsuleHalfHeight();
+		Sample.Radius = Capsule->GetScaledCapsuleRadius();
+		Sample.Time = Timestamp;
+	}
+}
+
+void UShooterLagCompensation::ValidatePendingHits()
+{
+	SCOPE_CYCLE_COUNTER(STAT_ShooterLagCompValidate);
+
+	// callbacks may queue or unregister, work on this frame's list only
+	TArray<FPendingHit> Hits = MoveTemp(PendingHits);
+	PendingHits.Reset();
+
+	for (const FPendingHit& Hit : Hits)
+	{
+		AShooterWeapon_Instant* Weapon = Hit.Weapon.Get();
+		if (Weapon == nullptr)
+		{
+			continue;
+		}
+
+		bool bConfirmed = false;
+		const int32* Index = HistoryIndices.Find(Hit.Target.Get());
+		if (Index && Histories[*Index].NumSamples > 0)
+		{
+			const FPoseSample Pose = GetPoseAtTime(Histories[*Index], Hit.Timestamp);
+			bConfirmed = IsWithinCapsule(Pose, Hit.Impact.Location, Hit.Tolerance);
+		}
+
+		if (bConfirmed)
+		{
+			INC_DWORD_STAT(STAT_ShooterLagCompHitsConfirmed);
+		}
+		else
+		{
+			INC_DWORD_STAT(STAT_ShooterLagCompHitsRejected);
+		}
+
+		Weapon->OnLagCompensatedHitValidated(Hit.Impact, Hit.ShootDir, Hit.RandomSeed, Hit.ReticleSpread, bConfirmed);
+	}
+}
+
+UShooterLagCompensation::FPoseSample UShooterLagCompensation::GetPoseAtTime(const FPoseHistory& History, float Time)
+{
+	const FPoseSample* Later = &History.Samples[History.Newest];
+	if (Time >= Later->Time)
+	{
+		return *Later;
+	}
+
+	// rewinds are short, walk back from the newest sample
+	for (int32 i = 1; i < History.NumSamples; i++)
+	{
+		const FPoseSample& Earlier = History.Samples[(History.Newest - i) & (HistorySize - 1)];
+		if (Earlier.Time <= Time)
+		{
+			const float Alpha = (Time - Earlier.Time) / FMath::Max(Later->Time - Earlier.Time, KINDA_SMALL_NUMBER);
+
+			FPoseSample Pose;
+			Pose.Center = FMath::Lerp(Earlier.Center, Later->Center, Alpha);
+			Pose.HalfHeight = FMath::Lerp(Earlier.HalfHeight, Later->HalfHeight, Alpha);
+			Pose.Radius = FMath::Lerp(Earlier.Radius, Later->Radius, Alpha);
+			Pose.Time = Time;
+			return Pose;
+		}
+
+		Later = &Earlier;
+	}
+
+	// older than anything recorded
+	return *Later;
+}
+
+bool UShooterLagCompensation::IsWithinCapsule(const FPoseSample& Pose, const FVector& Location, float Tolerance)
+{
+	// characters stay upright, so the capsule axis is always Z
+	const float SegmentHalfLength = FMath::Max(Pose.HalfHeight - Pose.Radius, 0.0f);
+	const FVector Offset = Location - Pose.Center;
+	const float AxisOffset = FMath::Clamp(Offset.Z, -SegmentHalfLength, SegmentHalfLength);
+	const float DistSq = FVector(Offset.X, Offset.Y, Offset.Z - AxisOffset).SizeSquared();
+
+	return DistSq <= FMath::Square(Pose.Radius + Tolerance);
+}
@@ -63,6 +63,31 @@ void AShooterProjectile::InitVelocity(FVector& ShootDirection)
 	}
 }
 
+TSubclassOf<AShooterExplosionEffect> AShooterProjectile::GetExplosionTemplate() const
+{
+	return ExplosionTemplate;
+}
+
+UParticleSystem* AShooterProjectile::GetTrailTemplate() const
+{
+	return ParticleComp ? ParticleComp->Template : nullptr;
+}
+
+float AShooterProjectile::GetCollisionRadius() const
+{
+	return CollisionComp ? CollisionComp->GetUnscaledSphereRadius() : 0.0f;
+}
+
+float AShooterProjectile::GetInitialSpeed() const
+{
+	return MovementComp ? MovementComp->InitialSpeed : 0.0f;
+}
+
+float AShooterProjectile::GetGravityScale() const
+{
+	return MovementComp ? MovementComp->ProjectileGravityScale : 0.0f;
+}
+
 void AShooterProjectile::OnImpact(const FHitResult& HitResult)
 {
 	if (GetLocalRole() == ROLE_Authority && !bExploded)
@@ -0,0 +1,302 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "Weapons/ShooterProjectileManager.h"
+#include "Weapons/ShooterWeapon_Projectile.h"
+#include "Weapons/ShooterProjectile.h"
+#include "Effects/ShooterExplosionEffect.h"
+#include "Particles/ParticleSystemComponent.h"
+#include "Async/ParallelFor.h"
+
+DECLARE_STATS_GROUP(TEXT("ShooterProjectiles"), STATGROUP_ShooterProjectiles, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Projectile Manager Tick"), STAT_ShooterProjectileManagerTick, STATGROUP_ShooterProjectiles);
+DECLARE_CYCLE_STAT(TEXT("Projectile Sweeps"), STAT_ShooterProjectileSweeps, STATGROUP_ShooterProjectiles);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Projectiles In Flight"), STAT_ShooterProjectilesInFlight, STATGROUP_ShooterProjectiles);
+
+static int32 ProjectileManagerEnable = 0;
+static FAutoConsoleVariableRef CVarProjectileManagerEnable(
+	TEXT("p.ProjectileManager.Enable"),
+	ProjectileManagerEnable,
+	TEXT("Simulate projectile weapons in a single manager instead of spawning a replicated actor per shot.\n")
+	TEXT("Must match between server and clients.\n")
+	TEXT("0: Disable, 1: Enable"),
+	ECVF_Default);
+
+static int32 ProjectileManagerMinParallelSweeps = 16;
+static FAutoConsoleVariableRef CVarProjectileManagerMinParallelSweeps(
+	TEXT("p.ProjectileManager.MinParallelSweeps"),
+	ProjectileManagerMinParallelSweeps,
+	TEXT("Below this many projectiles in flight, sweeps run on the game thread only."),
+	ECVF_Default);
+
+namespace ShooterProjectileManager
+{
+	/** how many locally exploded projectiles to remember while waiting for the server's report */
+	const int32 MaxRecentlyExploded = 64;
+}
+
+bool UShooterProjectileManager::IsEnabled()
+{
+	return ProjectileManagerEnable != 0;
+}
+
+void UShooterProjectileManager::Deinitialize()
+{
+	DEC_DWORD_STAT_BY(STAT_ShooterProjectilesInFlight, ProjectileIds.Num());
+
+	for (UParticleSystemComponent* Trail : Trails)
+	{
+		if (Trail)
+		{
+			Trail->Deactivate();
+			Trail->ReleaseToPool();
+		}
+	}
+
+	ProjectileIds.Empty();
+	ProjectileTypeIndices.Empty();
+	Locations.Empty();
+	Velocities.Empty();
+	LifeRemaining.Empty();
+	Weapons.Empty();
+	Instigators.Empty();
+	InstigatorControllers.Empty();
+	Trails.Empty();
+	SweepIgnoredActors.Empty();
+	ProjectileTypes.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UShooterProjectileManager::IsTickable() const
+{
+	return ProjectileIds.Num() > 0;
+}
+
+TStatId UShooterProjectileManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UShooterProjectileManager, STATGROUP_Tickables);
+}
+
+uint32 UShooterProjectileManager::AllocateProjectileId()
+{
+	return ++NextProjectileId;
+}
+
+int32 UShooterProjectileManager::GetProjectileTypeIndex(AShooterWeapon_Projectile* Weapon)
+{
+	UClass* WeaponClass = Weapon->GetClass();
+	const int32 ExistingIndex = ProjectileTypes.IndexOfByPredicate([WeaponClass](const FProjectileType& Type)
+	{
+		return Type.WeaponClass == WeaponClass;
+	});
+	if (ExistingIndex != INDEX_NONE)
+	{
+		return ExistingIndex;
+	}
+
+	FProjectileWeaponData WeaponConfig;
+	Weapon->ApplyWeaponConfig(WeaponConfig);
+
+	FProjectileType& Type = ProjectileTypes.AddDefaulted_GetRef();
+	Type.WeaponClass = WeaponClass;
+	Type.ProjectileLife = WeaponConfig.ProjectileLife;
+	Type.ExplosionDamage = WeaponConfig.ExplosionDamage;
+	Type.ExplosionRadius = WeaponConfig.ExplosionRadius;
+	Type.DamageType = WeaponConfig.DamageType;
+
+	// everything else comes from the projectile blueprint that would have been spawned
+	const AShooterProjectile* ProjectileCDO = WeaponConfig.ProjectileClass ? WeaponConfig.ProjectileClass->GetDefaultObject<AShooterProjectile>() : nullptr;
+	Type.ExplosionTemplate = ProjectileCDO ? ProjectileCDO->GetExplosionTemplate() : nullptr;
+	Type.TrailTemplate = ProjectileCDO ? ProjectileCDO->GetTrailTemplate() : nullptr;
+	Type.CollisionRadius = ProjectileCDO ? ProjectileCDO->GetCollisionRadius() : 5.0f;
+	Type.InitialSpeed = ProjectileCDO ? ProjectileCDO->GetInitialSpeed() : 2000.0f;
+	Type.GravityScale = ProjectileCDO ? ProjectileCDO->GetGravityScale() : 0.0f;
+
+	return ProjectileTypes.Num() - 1;
+}
+
+void UShooterProjectileManager::AddProjectile(AShooterWeapon_Projectile* Weapon, uint32 ProjectileId, const FVector& Origin, const FVector& ShootDir)
+{
+	if (Weapon == nullptr)
+	{
+		return;
+	}
+
+	const int32 TypeIndex = GetProjectileTypeIndex(Weapon);
+	const FProjectileType& Type = ProjectileTypes[TypeIndex];
+
+	ProjectileIds.Add(ProjectileId);
+	ProjectileTypeIndices.Add(TypeIndex);
+	Locations.Add(Origin);
+	Velocities.Add(ShootDir * Type.InitialSpeed);
+	LifeRemaining.Add(Type.ProjectileLife);
+	Weapons.Add(Weapon);
+	Instigators.Add(Weapon->GetPawnOwner());
+	InstigatorControllers.Add(Weapon->GetInstigatorController());
+
+	UParticleSystemComponent* Trail = nullptr;
+	if (Type.TrailTemplate && GetWorld()->GetNetMode() != NM_DedicatedServer)
+	{
+		Trail = UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), Type.TrailTemplate, Origin, ShootDir.Rotation(), FVector(1.0f), true, EPSCPoolMethod::ManualRelease);
+	}
+	Trails.Add(Trail);
+
+	INC_DWORD_STAT(STAT_ShooterProjectilesInFlight);
+}
+
+void UShooterProjectileManager::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ShooterProjectileManagerTick);
+
+	UWorld* World = GetWorld();
+	const int32 NumProjectiles = ProjectileIds.Num();
+	if (World == nullptr || NumProjectiles == 0)
+	{
+		return;
+	}
+
+	// integrate
+	const float GravityZ = World->GetGravityZ();
+	SweepEnds.SetNumUninitialized(NumProjectiles, false);
+	SweepIgnoredActors.SetNumUninitialized(NumProjectiles, false);
+	for (int32 i = 0; i < NumProjectiles; i++)
+	{
+		Velocities[i].Z += GravityZ * ProjectileTypes[ProjectileTypeIndices[i]].GravityScale * DeltaTime;
+		SweepEnds[i] = Locations[i] + Velocities[i] * DeltaTime;
+
+		// weak pointers may only be resolved on the game thread
+		SweepIgnoredActors[i] = Instigators[i].Get();
+	}
+
+	// sweep all projectiles at once; scene queries are read only, so they can run side by side
+	SweepHits.SetNum(NumProjectiles, false);
+	SweepBlocked.SetNumZeroed(NumProjectiles, false);
+	{
+		SCOPE_CYCLE_COUNTER(STAT_ShooterProjectileSweeps);
+
+		const bool bSingleThreaded = NumProjectiles < ProjectileManagerMinParallelSweeps;
+		ParallelFor(NumProjectiles, [this, World](int32 i)
+		{
+			FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ProjectileManager), true, SweepIgnoredActors[i]);
+			const FCollisionShape Shape = FCollisionShape::MakeSphere(ProjectileTypes[ProjectileTypeIndices[i]].CollisionRadius);
+			SweepBlocked[i] = World->SweepSingleByChannel(SweepHits[i], Locations[i], SweepEnds[i], FQuat::Identity, COLLISION_PROJECTILE, Shape, QueryParams);
+		}, bSingleThreaded);
+	}
+
+	// resolve, back to front so removals don't disturb unvisited entries
+	for (int32 i = NumProjectiles - 1; i >= 0; i--)
+	{
+		if (SweepBlocked[i])
+		{
+			Explode(i, SweepHits[i]);
+			RemoveProjectile(i);
+			continue;
+		}
+
+		LifeRemaining[i] -= DeltaTime;
+		if (LifeRemaining[i] <= 0.0f)
+		{
+			RemoveProjectile(i);
+			continue;
+		}
+
+		Locations[i] = SweepEnds[i];
+		if (UParticleSystemComponent* Trail = Trails[i])
+		{
+			Trail->SetWorldLocationAndRotation(Locations[i], Velocities[i].Rotation());
+		}
+	}
+}
+
+void UShooterProjectileManager::Explode(int32 Index, const FHitResult& Impact)
+{
+	const FProjectileType& Type = ProjectileTypes[ProjectileTypeIndices[Index]];
+
+	// effects and damage origin shouldn't be placed inside mesh at impact point
+	const FVector NudgedImpactLocation = Impact.ImpactPoint + Impact.ImpactNormal * 10.0f;
+
+	if (GetWorld()->GetNetMode() != NM_Client)
+	{
+		AShooterWeapon_Projectile* Weapon = Weapons[Index].Get();
+
+		if (Type.ExplosionDamage > 0 && Type.ExplosionRadius > 0 && Type.DamageType)
+		{
+			UGameplayStatics::ApplyRadialDamage(GetWorld(), Type.ExplosionDamage, NudgedImpactLocation, Type.ExplosionRadius, Type.DamageType, TArray<AActor*>(), Weapon, InstigatorControllers[Index].Get());
+		}
+
+		// clients simulate the same flight, this only corrects where they think it hit
+		if (Weapon)
+		{
+			Weapon->MulticastProjectileExploded(ProjectileIds[Index], Impact.ImpactPoint, Impact.ImpactNormal);
+		}
+	}
+	else
+	{
+		RecentlyExplodedIds.Add(ProjectileIds[Index]);
+		if (RecentlyExplodedIds.Num() > ShooterProjectileManager::MaxRecentlyExploded)
+		{
+			RecentlyExplodedIds.RemoveAt(0, 1, false);
+		}
+	}
+
+	SpawnExplosionEffect(Type.ExplosionTemplate, Impact);
+}
+
+void UShooterProjectileManager::OnRemoteExplosion(uint32 ProjectileId, const FVector& ImpactPoint, const FVector& ImpactNormal, TSubclassOf<AShooterExplosionEffect> ExplosionTemplate)
+{
+	if (RecentlyExplodedIds.Remove(ProjectileId) > 0)
+	{
+		return;
+	}
+
+	FHitResult Impact;
+	Impact.ImpactPoint = ImpactPoint;
+	Impact.ImpactNormal = ImpactNormal;
+
+	const int32 Index = ProjectileIds.Find(ProjectileId);
+	if (Index != INDEX_NONE)
+	{
+		RemoveProjectile(Index);
+	}
+
+	// also covers projectiles whose spawn never reached us
+	SpawnExplosionEffect(ExplosionTemplate, Impact);
+}
+
+void UShooterProjectileManager::SpawnExplosionEffect(TSubclassOf<AShooterExplosionEffect> ExplosionTemplate, const FHitResult& Impact)
+{
+	if (ExplosionTemplate && GetWorld()->GetNetMode() != NM_DedicatedServer)
+	{
+		const FVector NudgedImpactLocation = Impact.ImpactPoint + Impact.ImpactNormal * 10.0f;
+		FTransform const SpawnTransform(Impact.ImpactNormal.Rotation(), NudgedImpactLocation);
+		AShooterExplosionEffect* const EffectActor = GetWorld()->SpawnActorDeferred<AShooterExplosionEffect>(ExplosionTemplate, SpawnTransform);
+		if (EffectActor)
+		{
+			EffectActor->SurfaceHit = Impact;
+			UGameplayStatics::FinishSpawningActor(EffectActor, SpawnTransform);
+		}
+	}
+}
+
+void UShooterProjectileManager::RemoveProjectile(int32 Index)
+{
+	// let the trail fade out; releasing an active component returns it to the particle pool when it completes
+	if (UParticleSystemComponent* Trail = Trails[Index])
+	{
+		Trail->Deactivate();
+		Trail->ReleaseToPool();
+	}
+
+	ProjectileIds.RemoveAtSwap(Index, 1, false);
+	ProjectileTypeIndices.RemoveAtSwap(Index, 1, false);
+	Locations.RemoveAtSwap(Index, 1, false);
+	Velocities.RemoveAtSwap(Index, 1, false);
+	LifeRemaining.RemoveAtSwap(Index, 1, false);
+	Weapons.RemoveAtSwap(Index, 1, false);
+	Instigators.RemoveAtSwap(Index, 1, false);
+	InstigatorControllers.RemoveAtSwap(Index, 1, false);
+	Trails.RemoveAtSwap(Index, 1, false);
+
+	DEC_DWORD_STAT(STAT_ShooterProjectilesInFlight);
+}
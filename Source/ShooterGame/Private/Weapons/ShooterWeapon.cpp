@@ -435,6 +435,12 @@ void AShooterWeapon::HandleFiring()
 			SimulateWeaponFire();
 		}
 
+		// remote clients reach this through ServerHandleFiring, local owners on the server directly
+		if (GetLocalRole() == ROLE_Authority)
+		{
+			OnServerFired();
+		}
+
 		if (MyPawn && MyPawn->IsLocallyControlled())
 		{
 			FireWeapon();
@@ -4,6 +4,9 @@
 #include "Weapons/ShooterWeapon_Instant.h"
 #include "Particles/ParticleSystemComponent.h"
 #include "Effects/ShooterImpactEffect.h"
+#include "Effects/ShooterEffectPool.h"
+#include "Weapons/ShooterLagCompensation.h"
+#include "AcousticsStimulusBus.h"
 
 AShooterWeapon_Instant::AShooterWeapon_Instant(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
@@ -31,12 +34,18 @@ void AShooterWeapon_Instant::FireWeapon()
 	CurrentFiringSpread = FMath::Min(InstantConfig.FiringSpreadMax, CurrentFiringSpread + InstantConfig.FiringSpreadIncrement);
 }
 
-bool AShooterWeapon_Instant::ServerNotifyHit_Validate(const FHitResult& Impact, FVector_NetQuantizeNormal ShootDir, int32 RandomSeed, float ReticleSpread)
+void AShooterWeapon_Instant::OnServerFired()
+{
+	// AI perception runs on the server, which does not run FireWeapon for remote players
+	FAcousticsStimulusBus::Get().Post(GetMuzzleLocation(), InstantConfig.FireLoudnessDb, GetInstigator());
+}
+
+bool AShooterWeapon_Instant::ServerNotifyHit_Validate(const FHitResult& Impact, FVector_NetQuantizeNormal ShootDir, int32 RandomSeed, float ReticleSpread, float ClientTimestamp)
 {
 	return true;
 }
 
-void AShooterWeapon_Instant::ServerNotifyHit_Implementation(const FHitResult& Impact, FVector_NetQuantizeNormal ShootDir, int32 RandomSeed, float ReticleSpread)
+void AShooterWeapon_Instant::ServerNotifyHit_Implementation(const FHitResult& Impact, FVector_NetQuantizeNormal ShootDir, int32 RandomSeed, float ReticleSpread, float ClientTimestamp)
 {
 	const float WeaponAngleDot = FMath::Abs(FMath::Sin(ReticleSpread * PI / 180.f));
 
@@ -67,6 +76,15 @@ void AShooterWeapon_Instant::ServerNotifyHit_Implementation(const FHitResult& Im
 				}
 				else
 				{
+					// characters are checked against where they were when the client fired, together with the other hits of this frame
+					AShooterCharacter* HitCharacter = Cast<AShooterCharacter>(Impact.GetActor());
+					UShooterLagCompensation* LagCompensation = GetWorld()->GetSubsystem<UShooterLagCompensation>();
+					if (HitCharacter && LagCompensation && UShooterLagCompensation::IsEnabled() && LagCompensation->IsCharacterTracked(HitCharacter))
+					{
+						LagCompensation->QueueHitValidation(this, HitCharacter, Impact, ShootDir, RandomSeed, ReticleSpread, ClientTimestamp, InstantConfig.LagCompensationTolerance);
+						return;
+					}
+
 					// Get the component bounding box
 					const FBox HitBox = Impact.GetActor()->GetComponentsBoundingBox();
 
@@ -107,6 +125,18 @@ void AShooterWeapon_Instant::ServerNotifyHit_Implementation(const FHitResult& Im
 	}
 }
 
+void AShooterWeapon_Instant::OnLagCompensatedHitValidated(const FHitResult& Impact, const FVector& ShootDir, int32 RandomSeed, float ReticleSpread, bool bConfirmed)
+{
+	if (bConfirmed)
+	{
+		ProcessInstantHit_Confirmed(Impact, GetMuzzleLocation(), ShootDir, RandomSeed, ReticleSpread);
+	}
+	else
+	{
+		UE_LOG(LogShooterWeapon, Log, TEXT("%s Rejected client side hit of %s (outside rewound capsule tolerance)"), *GetNameSafe(this), *GetNameSafe(Impact.GetActor()));
+	}
+}
+
 bool AShooterWeapon_Instant::ServerNotifyMiss_Validate(FVector_NetQuantizeNormal ShootDir, int32 RandomSeed, float ReticleSpread)
 {
 	return true;
@@ -137,14 +167,14 @@ void AShooterWeapon_Instant::ProcessInstantHit(const FHitResult& Impact, const F
 		if (Impact.GetActor() && Impact.GetActor()->GetRemoteRole() == ROLE_Authority)
 		{
 			// notify the server of the hit
-			ServerNotifyHit(Impact, ShootDir, RandomSeed, ReticleSpread);
+			ServerNotifyHit(Impact, ShootDir, RandomSeed, ReticleSpread, UShooterLagCompensation::GetTimestamp(GetWorld()));
 		}
 		else if (Impact.GetActor() == NULL)
 		{
 			if (Impact.bBlockingHit)
 			{
 				// notify the server of the hit
-				ServerNotifyHit(Impact, ShootDir, RandomSeed, ReticleSpread);
+				ServerNotifyHit(Impact, ShootDir, RandomSeed, ReticleSpread, UShooterLagCompensation::GetTimestamp(GetWorld()));
 			}
 			else
 			{
@@ -281,11 +311,9 @@ void AShooterWeapon_Instant::SpawnImpactEffects(const FHitResult& Impact)
 		}
 
 		FTransform const SpawnTransform(Impact.ImpactNormal.Rotation(), Impact.ImpactPoint);
-		AShooterImpactEffect* EffectActor = GetWorld()->SpawnActorDeferred<AShooterImpactEffect>(ImpactTemplate, SpawnTransform);
-		if (EffectActor)
+		if (UShooterEffectPool* EffectPool = GetWorld()->GetSubsystem<UShooterEffectPool>())
 		{
-			EffectActor->SurfaceHit = UseImpact;
-			UGameplayStatics::FinishSpawningActor(EffectActor, SpawnTransform);
+			EffectPool->SpawnImpactEffect(ImpactTemplate, SpawnTransform, UseImpact);
 		}
 	}
 }
@@ -296,7 +324,8 @@ void AShooterWeapon_Instant::SpawnTrailEffect(const FVector& EndPoint)
 	{
 		const FVector Origin = GetMuzzleLocation();
 
-		UParticleSystemComponent* TrailPSC = UGameplayStatics::SpawnEmitterAtLocation(this, TrailFX, Origin);
+		UShooterEffectPool* EffectPool = GetWorld()->GetSubsystem<UShooterEffectPool>();
+		UParticleSystemComponent* TrailPSC = EffectPool ? EffectPool->SpawnTrailEffect(TrailFX, Origin) : nullptr;
 		if (TrailPSC)
 		{
 			TrailPSC->SetVectorParameter(TrailTargetParam, EndPoint);
@@ -3,6 +3,7 @@
 #include "ShooterGame.h"
 #include "Weapons/ShooterWeapon_Projectile.h"
 #include "Weapons/ShooterProjectile.h"
+#include "Weapons/ShooterProjectileManager.h"
 
 AShooterWeapon_Projectile::AShooterWeapon_Projectile(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
@@ -71,6 +72,16 @@ bool AShooterWeapon_Projectile::ServerFireProjectile_Validate(FVector Origin, FV
 
 void AShooterWeapon_Projectile::ServerFireProjectile_Implementation(FVector Origin, FVector_NetQuantizeNormal ShootDir)
 {
+	if (UShooterProjectileManager::IsEnabled())
+	{
+		UShooterProjectileManager* ProjectileManager = GetWorld()->GetSubsystem<UShooterProjectileManager>();
+		if (ProjectileManager)
+		{
+			MulticastFireProjectile(ProjectileManager->AllocateProjectileId(), Origin, ShootDir);
+			return;
+		}
+	}
+
 	FTransform SpawnTM(ShootDir.Rotation(), Origin);
 	AShooterProjectile* Projectile = Cast<AShooterProjectile>(UGameplayStatics::BeginDeferredActorSpawnFromClass(this, ProjectileConfig.ProjectileClass, SpawnTM));
 	if (Projectile)
@@ -83,6 +94,29 @@ void AShooterWeapon_Projectile::ServerFireProjectile_Implementation(FVector Orig
 	}
 }
 
+void AShooterWeapon_Projectile::MulticastFireProjectile_Implementation(uint32 ProjectileId, FVector_NetQuantize Origin, FVector_NetQuantizeNormal ShootDir)
+{
+	// runs on the server as well, which is the only place the projectile deals damage
+	if (UShooterProjectileManager* ProjectileManager = GetWorld()->GetSubsystem<UShooterProjectileManager>())
+	{
+		ProjectileManager->AddProjectile(this, ProjectileId, Origin, ShootDir);
+	}
+}
+
+void AShooterWeapon_Projectile::MulticastProjectileExploded_Implementation(uint32 ProjectileId, FVector_NetQuantize ImpactPoint, FVector_NetQuantizeNormal ImpactNormal)
+{
+	if (GetNetMode() != NM_Client)
+	{
+		return;
+	}
+
+	if (UShooterProjectileManager* ProjectileManager = GetWorld()->GetSubsystem<UShooterProjectileManager>())
+	{
+		const AShooterProjectile* ProjectileCDO = ProjectileConfig.ProjectileClass ? ProjectileConfig.ProjectileClass->GetDefaultObject<AShooterProjectile>() : nullptr;
+		ProjectileManager->OnRemoteExplosion(ProjectileId, ImpactPoint, ImpactNormal, ProjectileCDO ? ProjectileCDO->GetExplosionTemplate() : nullptr);
+	}
+}
+
 void AShooterWeapon_Projectile::ApplyWeaponConfig(FProjectileWeaponData& Data)
 {
 	Data = ProjectileConfig;
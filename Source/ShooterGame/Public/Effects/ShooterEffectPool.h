@@ -0,0 +1,38 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "ShooterEffectPool.generated.h"
+
+class AShooterImpactEffect;
+
+//
+// Per-world spawner for hit effects, so sustained fire doesn't create and destroy a particle system per hit.
+// Impact and trail particle systems are recycled through the engine's particle system component pool.
+// Impact actors are still spawned per hit: their effects are fire-and-forget, so they finish as soon as they spawn.
+//
+UCLASS()
+class UShooterEffectPool : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** play an impact effect at the given transform, its particle systems come from the particle pool */
+	AShooterImpactEffect* SpawnImpactEffect(TSubclassOf<AShooterImpactEffect> ImpactTemplate, const FTransform& SpawnTransform, const FHitResult& SurfaceHit);
+
+	/** spawn a trail particle system from Origin, released back to the pool when it completes */
+	UParticleSystemComponent* SpawnTrailEffect(UParticleSystem* TrailTemplate, const FVector& Origin);
+
+	/** number of impact effects played since the world started */
+	int32 GetNumImpactsSpawned() const { return NumImpactsSpawned; }
+
+	/** number of trail effects played */
+	int32 GetNumTrailsSpawned() const { return NumTrailsSpawned; }
+
+private:
+
+	int32 NumImpactsSpawned;
+	int32 NumTrailsSpawned;
+};
@@ -97,6 +97,9 @@ class AShooterImpactEffect : public AActor
 	/** spawn effect */
 	virtual void PostInitializeComponents() override;
 
+	/** set by UShooterEffectPool before spawning finishes; particle systems are taken from the world's particle pool */
+	uint8 bUsePooledEmitters : 1;
+
 protected:
 
 	/** get FX for material type */
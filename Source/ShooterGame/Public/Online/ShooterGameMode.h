@@ -4,11 +4,13 @@
 
 #include "OnlineIdentityInterface.h"
 #include "ShooterPlayerController.h"
+#include "Pickups/ShooterPickupIndex.h"
 #include "ShooterGameMode.generated.h"
 
 class AShooterAIController;
 class AShooterPlayerState;
 class AShooterPickup;
+class AShooterCharacter;
 class FUniqueNetId;
 
 UCLASS(config=Game)
@@ -159,4 +161,24 @@ public:
 	UPROPERTY()
 	TArray<AShooterPickup*> LevelPickups;
 
+	/** add a pickup placed in the level */
+	void RegisterPickup(AShooterPickup* Pickup);
+
+	/** remove a pickup leaving the level */
+	void UnregisterPickup(AShooterPickup* Pickup);
+
+	/** pickup was taken or respawned */
+	void OnPickupAvailabilityChanged(AShooterPickup* Pickup);
+
+	/**
+	 * Finds the closest available pickup of a category that the pawn can use.
+	 * Candidates come from the pickup index and the nearest few are compared by navigation path length.
+	 */
+	AShooterPickup* FindNearestPickup(UClass* CategoryClass, AShooterCharacter* ForPawn) const;
+
+protected:
+
+	/** spatial index of available pickups */
+	FShooterPickupIndex PickupIndex;
+
 };
@@ -33,5 +33,33 @@ public:
 	/** gets ranked PlayerState map for specific team */
 	void GetRankedMap(int32 TeamIndex, RankedPlayerMap& OutRankedMap) const;	
 
+	/** gets ranked PlayerState map for specific team without copying it, null if the team doesn't exist */
+	const RankedPlayerMap* GetRankedMapRef(int32 TeamIndex) const;
+
+	/** changes whenever any ranked map changes; compare against a stored value to skip rebuilding UI */
+	uint32 GetRankedMapVersion() const;
+
+	/** called by player states when their score or team changes */
+	void InvalidateRankedMaps();
+
 	void RequestFinishAndExitToMainMenu();
+
+	// Begin AGameStateBase interface
+	virtual void AddPlayerState(APlayerState* PlayerState) override;
+	virtual void RemovePlayerState(APlayerState* PlayerState) override;
+	// End AGameStateBase interface
+
+private:
+
+	/** rebuilds the ranked maps if anything changed since they were last built */
+	void UpdateRankedMaps() const;
+
+	/** ranked PlayerState map per team, rebuilt only after InvalidateRankedMaps */
+	mutable TArray<RankedPlayerMap> RankedMaps;
+
+	/** incremented every time RankedMaps is rebuilt */
+	mutable uint32 RankedMapVersion;
+
+	/** true when a score or team changed since RankedMaps was built */
+	mutable bool bRankedMapsDirty;
 };
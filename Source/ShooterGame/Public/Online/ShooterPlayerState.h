@@ -24,6 +24,9 @@ class AShooterPlayerState : public APlayerState
 	virtual void RegisterPlayerWithSession(bool bWasFromInvite) override;
 	virtual void UnregisterPlayerWithSession() override;
 
+	/** [client] score changed, update the ranking */
+	virtual void OnRep_Score() override;
+
 	// End APlayerState interface
 
 	/**
@@ -111,4 +114,7 @@ protected:
 
 	/** helper for scoring points */
 	void ScorePoints(int32 Points);
+
+	/** tell the game state the ranked maps need a rebuild */
+	void InvalidateRanking();
 };
@@ -16,10 +16,19 @@ class AShooterPickup : public AActor
 	/** check if pawn can use this pickup */
 	virtual bool CanBePickedUp(class AShooterCharacter* TestPawn) const;
 
+	/** class used to group this pickup in the game mode's pickup index */
+	virtual UClass* GetPickupCategory() const;
+
+	/** is it ready for interactions? */
+	bool IsPickupActive() const;
+
 protected:
 	/** initial setup */
 	virtual void BeginPlay() override;
 
+	/** remove from the pickup index */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 private:
 	/** FX component */
 	UPROPERTY(VisibleDefaultsOnly, Category=Effects)
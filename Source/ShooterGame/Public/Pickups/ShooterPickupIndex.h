@@ -0,0 +1,55 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+class AShooterPickup;
+
+/**
+ * 2D grid of available pickups, bucketed by category (see AShooterPickup::GetPickupCategory).
+ * Owned by the game mode and kept up to date by the pickups themselves, so a bot looking for a pickup
+ * only visits the cells around it instead of every pickup in the level.
+ */
+class FShooterPickupIndex
+{
+public:
+
+	/** a pickup found by FindNearest */
+	struct FCandidate
+	{
+		AShooterPickup* Pickup;
+		float DistSq;
+	};
+
+	/** add or remove a pickup depending on whether it can currently be picked up */
+	void UpdatePickup(AShooterPickup* Pickup, bool bAvailable);
+
+	/** forget a pickup entirely */
+	void RemovePickup(AShooterPickup* Pickup);
+
+	/**
+	 * Finds up to MaxCandidates available pickups nearest to Origin, closest first.
+	 *
+	 * @param	CategoryClass	only pickups whose category is this class or a child of it are considered
+	 * @param	Filter			extra test for each pickup, e.g. whether the pawn can use it
+	 */
+	void FindNearest(const UClass* CategoryClass, const FVector& Origin, int32 MaxCandidates, TFunctionRef<bool(AShooterPickup*)> Filter, TArray<FCandidate>& OutCandidates) const;
+
+private:
+
+	struct FCategory
+	{
+		TMap<FIntPoint, TArray<AShooterPickup*>> Cells;
+		FIntPoint MinCell = FIntPoint(MAX_int32, MAX_int32);
+		FIntPoint MaxCell = FIntPoint(MIN_int32, MIN_int32);
+	};
+
+	static FIntPoint GetCell(const FVector& Location);
+
+	/** visit the pickups of one cell, keeping OutCandidates sorted and at most MaxCandidates long */
+	static void GatherCell(const FCategory& Category, const FIntPoint& Cell, const FVector& Origin, int32 MaxCandidates, TFunctionRef<bool(AShooterPickup*)> Filter, TArray<FCandidate>& OutCandidates);
+
+	TMap<const UClass*, FCategory> Categories;
+
+	/** where each indexed pickup is, so it can be removed without knowing its old state */
+	TMap<AShooterPickup*, TPair<const UClass*, FIntPoint>> IndexedPickups;
+};
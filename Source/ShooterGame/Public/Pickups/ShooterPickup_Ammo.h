@@ -19,6 +19,9 @@ class AShooterPickup_Ammo : public AShooterPickup
 
 	bool IsForWeapon(UClass* WeaponClass);
 
+	/** ammo pickups are grouped by the weapon they refill */
+	virtual UClass* GetPickupCategory() const override;
+
 protected:
 
 	/** how much ammo does it give? */
@@ -30,6 +30,12 @@ class AShooterCharacter : public ACharacter
 	/** [server] perform PlayerState related setup */
 	virtual void PossessedBy(class AController* C) override;
 
+	/** [server] stop treating sounds as coming from the local player */
+	virtual void UnPossessed() override;
+
+	/** [client] update local player sound state for the new controller */
+	virtual void OnRep_Controller() override;
+
 	/** [client] perform PlayerState related setup */
 	virtual void OnRep_PlayerState() override;
 
@@ -382,6 +388,9 @@ protected:
 	/** Responsible for cleaning up bodies on clients. */
 	virtual void TornOff();
 
+	/** publish whether this pawn is locally controlled to USoundNodeLocalPlayer */
+	void UpdateLocalPlayerSoundState();
+
 private:
 
 	/** Whether or not the character is moving (based on movement input). */
@@ -475,6 +484,47 @@ protected:
 	/** Builds list of points to check for pausing replication for a connection*/
 	void BuildPauseReplicationCheckPoints(TArray<FVector>& RelevancyCheckPoints);
 
+private:
+	/** Cached result of the pause replication occlusion test from one viewpoint */
+	struct FPauseRelevancyEntry
+	{
+		/** Quantized view location; connections viewing from the same cell share the entry */
+		FIntVector ViewCell;
+
+		/** Passed as user data to the async traces so results can find their entry */
+		uint32 Id;
+
+		/** World time of the last completed test */
+		float Time;
+
+		/** Traces of the current batch that have not reported back yet */
+		int32 PendingTraces;
+
+		/** True if any trace of the current batch was unblocked */
+		bool bAnyVisibleInBatch;
+
+		/** Result of the last completed batch */
+		bool bVisible;
+
+		/** True once at least one batch has completed */
+		bool bHasResult;
+	};
+
+	/** [server] occlusion results per viewpoint, refreshed through async traces */
+	TArray<FPauseRelevancyEntry> PauseRelevancyCache;
+
+	/** [server] id handed to the next cache entry */
+	uint32 NextPauseRelevancyEntryId;
+
+	/** [server] delegate for the async pause replication traces */
+	FTraceDelegate PauseRelevancyTraceDelegate;
+
+	/** [server] queue async traces from every check point to the view location of the entry */
+	void RequestPauseRelevancyTraces(FPauseRelevancyEntry& Entry, const FVector& ViewLocation, const APawn* ViewPawn);
+
+	/** [server] an async pause replication trace completed */
+	void OnPauseRelevancyTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+
 protected:
 	/** Returns Mesh1P subobject **/
 	FORCEINLINE USkeletalMeshComponent* GetMesh1P() const { return Mesh1P; }
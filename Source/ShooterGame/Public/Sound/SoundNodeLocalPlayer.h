@@ -22,13 +22,23 @@ class USoundNodeLocalPlayer : public USoundNode
 #endif
 	// End USoundNode interface.
 
-	static TMap<uint32, bool>& GetLocallyControlledActorCache()
-	{
-		check(IsInAudioThread());
-		return LocallyControlledActorCache;
-	}
+	/**
+	 * [game thread] Publish whether the actor with the given unique ID is locally controlled.
+	 * Only changes are sent to the audio thread, so this is cheap to call whenever control may have changed.
+	 */
+	static void SetLocallyControlledActor(uint32 ActorID, bool bLocallyControlled);
+
+	/** [audio thread] Returns true if the actor with the given unique ID is locally controlled */
+	static bool IsLocallyControlledActor(uint32 ActorID);
 
 private:
 
-	static TMap<uint32, bool> LocallyControlledActorCache;
+	/** Only a handful of actors are ever locally controlled, so a short unsorted list beats a map lookup */
+	typedef TArray<uint32, TInlineAllocator<4>> FLocallyControlledActorList;
+
+	/** Locally controlled actor IDs as last published by the game thread */
+	static FLocallyControlledActorList GameThreadLocallyControlledActors;
+
+	/** Locally controlled actor IDs as seen by the audio thread */
+	static FLocallyControlledActorList LocallyControlledActors;
 };
@@ -0,0 +1,76 @@
+// Copyright Epic Games, Inc.All Rights Reserved.
+#pragma once
+
+#include "Tests/ShooterTestControllerBase.h"
+#include "ShooterTestControllerBotSoak.generated.h"
+
+/**
+ * Headless performance soak for ShooterServer. Fills the current map with bots, optionally gives each of them
+ * acoustic ears, and runs for a fixed time while recording frame times and memory. Results are written to CSV
+ * and the test fails if any budget is exceeded.
+ *
+ * Command line (all optional):
+ *   -SoakBots=32                 number of bots to run with
+ *   -SoakAcousticListeners       attach a UAcousticsSecondaryListener listening to stimuli to every bot pawn
+ *   -SoakWarmupSeconds=10        time after the first map load that is not measured
+ *   -SoakDurationSeconds=300     measured time
+ *   -SoakMaxAvgFrameMs=0         fail if average game thread time exceeds this (0 = no budget)
+ *   -SoakMaxP99FrameMs=0         fail if 99th percentile game thread time exceeds this (0 = no budget)
+ *   -SoakMaxMemoryMB=0           fail if used physical memory exceeds this at any point (0 = no budget)
+ */
+UCLASS()
+class UShooterTestControllerBotSoak : public UShooterTestControllerBase
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnInit() override;
+	virtual void OnPostMapChange(UWorld* World) override;
+
+protected:
+	virtual void OnTick(float TimeDelta) override;
+
+	/** make sure the game mode runs the requested number of bots */
+	void SetupBots(UWorld* World);
+
+	/** give any bot pawn without ears an acoustics listener */
+	void AttachAcousticListeners(UWorld* World);
+
+	/** add one frame to the histograms and high-water marks */
+	void RecordFrame(float TimeDelta);
+
+	/** write results to CSV and end the test, failing it if a budget was exceeded */
+	void FinishSoak();
+
+	/** game thread time in ms below which the given fraction of measured frames fall */
+	float GetFrameTimePercentile(float Percentile) const;
+
+	// Settings
+	int32 NumBots;
+	uint8 bAttachAcousticListeners : 1;
+	float WarmupSeconds;
+	float DurationSeconds;
+	float MaxAvgFrameMs;
+	float MaxP99FrameMs;
+	float MaxMemoryMB;
+
+	// State
+	uint8 bInGame : 1;
+	uint8 bMeasuring : 1;
+	uint8 bFinished : 1;
+	double InGameStartTime;
+	double MeasureStartTime;
+	double LastListenerScanTime;
+	int32 NumListenersAttached;
+
+	// Results
+	/** game thread time histogram, 1ms per bucket; the last bucket holds everything slower */
+	TArray<int32> GameThreadHistogram;
+	int32 NumFrames;
+	double TotalGameThreadMs;
+	double TotalFrameMs;
+	float MaxGameThreadMs;
+	float MaxFrameMs;
+	uint64 MaxUsedPhysical;
+	uint64 MaxUsedVirtual;
+};
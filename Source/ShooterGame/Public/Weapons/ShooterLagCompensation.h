@@ -0,0 +1,116 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "ShooterLagCompensation.generated.h"
+
+class AShooterCharacter;
+class AShooterWeapon_Instant;
+
+//
+// Server side lag compensation for instant hit weapons.
+//
+// Every frame the capsule of each character is stored in a small fixed-size ring buffer. When a client reports a
+// hit on a character, the weapon queues it here with the client's estimate of the server time; all hits queued
+// during a frame are validated together at the end of it, against the capsule as it was at that time.
+//
+UCLASS()
+class UShooterLagCompensation : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+
+	/** true if hits on characters should be validated against their pose history */
+	static bool IsEnabled();
+
+	// Begin USubsystem interface
+	virtual void Deinitialize() override;
+	// End USubsystem interface
+
+	// Begin FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+	// End FTickableGameObject interface
+
+	/** [server] start recording the pose history of a character */
+	void RegisterCharacter(AShooterCharacter* Character);
+
+	/** [server] stop recording the pose history of a character */
+	void UnregisterCharacter(AShooterCharacter* Character);
+
+	/** is the character's pose history recorded? */
+	bool IsCharacterTracked(const AShooterCharacter* Character) const;
+
+	/** current time in the timeline used for pose history, on clients this is their estimate of it */
+	static float GetTimestamp(const UWorld* World);
+
+	/**
+	 * [server] queue a client reported hit on a tracked character, validated at the end of the frame.
+	 * The weapon is told the result through AShooterWeapon_Instant::OnLagCompensatedHitValidated.
+	 *
+	 * @param	ClientTimestamp		client's GetTimestamp() when it fired
+	 * @param	Tolerance			distance (cm) the impact may be outside the historical capsule
+	 */
+	void QueueHitValidation(AShooterWeapon_Instant* Weapon, AShooterCharacter* Target, const FHitResult& Impact, const FVector& ShootDir, int32 RandomSeed, float ReticleSpread, float ClientTimestamp, float Tolerance);
+
+private:
+
+	/** compact capsule pose of a character */
+	struct FPoseSample
+	{
+		FVector Center;
+		float HalfHeight;
+		float Radius;
+		float Time;
+	};
+
+	/** number of samples kept per character, a power of two */
+	static const int32 HistorySize = 64;
+
+	/** ring buffer of poses for one character */
+	struct FPoseHistory
+	{
+		TWeakObjectPtr<AShooterCharacter> Character;
+		FPoseSample Samples[HistorySize];
+		int32 NumSamples;
+		int32 Newest;
+	};
+
+	/** a client reported hit waiting for validation */
+	struct FPendingHit
+	{
+		TWeakObjectPtr<AShooterWeapon_Instant> Weapon;
+		TWeakObjectPtr<AShooterCharacter> Target;
+		FHitResult Impact;
+		FVector ShootDir;
+		int32 RandomSeed;
+		float ReticleSpread;
+		float Timestamp;
+		float Tolerance;
+	};
+
+	/** validate all hits queued this frame */
+	void ValidatePendingHits();
+
+	/** store the current pose of every tracked character */
+	void RecordPoses(float Timestamp);
+
+	/** pose of a character at Time, interpolated between the samples around it */
+	static FPoseSample GetPoseAtTime(const FPoseHistory& History, float Time);
+
+	/** is Location within Tolerance of the capsule? */
+	static bool IsWithinCapsule(const FPoseSample& Pose, const FVector& Location, float Tolerance);
+
+	/** recorded characters */
+	TArray<FPoseHistory> Histories;
+
+	/** index in Histories for each character */
+	TMap<const AShooterCharacter*, int32> HistoryIndices;
+
+	/** hits reported this frame */
+	TArray<FPendingHit> PendingHits;
+};
@@ -25,6 +25,21 @@ class AShooterProjectile : public AActor
 	UFUNCTION()
 	void OnImpact(const FHitResult& HitResult);
 
+	/** explosion effect class, read from the class default object by UShooterProjectileManager */
+	TSubclassOf<class AShooterExplosionEffect> GetExplosionTemplate() const;
+
+	/** in flight particle effect */
+	UParticleSystem* GetTrailTemplate() const;
+
+	/** radius of the collision sphere */
+	float GetCollisionRadius() const;
+
+	/** speed at launch */
+	float GetInitialSpeed() const;
+
+	/** scale applied to world gravity */
+	float GetGravityScale() const;
+
 private:
 	/** movement component */
 	UPROPERTY(VisibleDefaultsOnly, Category=Projectile)
@@ -0,0 +1,109 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "ShooterProjectileManager.generated.h"
+
+class AShooterWeapon_Projectile;
+class AShooterExplosionEffect;
+
+//
+// Simulates projectiles of every AShooterWeapon_Projectile in the world without spawning an actor per shot.
+// Enabled with p.ProjectileManager.Enable; the actor based AShooterProjectile path is used otherwise.
+//
+// The server and every client run the same straight-line (plus gravity) simulation from the replicated spawn
+// parameters, so nothing is replicated while a projectile is in flight. Only the server applies damage and
+// tells clients where it exploded; clients show the explosion at their own impact point if they get there first.
+// State is kept as parallel arrays and all sweeps of a frame are issued together across worker threads.
+//
+UCLASS()
+class UShooterProjectileManager : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+
+	/** true if projectile weapons should fire through the manager */
+	static bool IsEnabled();
+
+	// Begin USubsystem interface
+	virtual void Deinitialize() override;
+	// End USubsystem interface
+
+	// Begin FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+	// End FTickableGameObject interface
+
+	/** [server] reserve an id for a new projectile, to be sent to clients with its spawn parameters */
+	uint32 AllocateProjectileId();
+
+	/** start simulating a projectile fired by Weapon */
+	void AddProjectile(AShooterWeapon_Projectile* Weapon, uint32 ProjectileId, const FVector& Origin, const FVector& ShootDir);
+
+	/** [client] the server reported an explosion; show it unless we already did */
+	void OnRemoteExplosion(uint32 ProjectileId, const FVector& ImpactPoint, const FVector& ImpactNormal, TSubclassOf<AShooterExplosionEffect> ExplosionTemplate);
+
+	/** number of projectiles in flight */
+	int32 GetNumProjectiles() const { return ProjectileIds.Num(); }
+
+private:
+
+	/** data shared by all projectiles fired by one weapon class */
+	struct FProjectileType
+	{
+		UClass* WeaponClass;
+		float ProjectileLife;
+		int32 ExplosionDamage;
+		float ExplosionRadius;
+		TSubclassOf<UDamageType> DamageType;
+		TSubclassOf<AShooterExplosionEffect> ExplosionTemplate;
+		UParticleSystem* TrailTemplate;
+		float CollisionRadius;
+		float InitialSpeed;
+		float GravityScale;
+	};
+
+	/** find or create the type entry for Weapon's class */
+	int32 GetProjectileTypeIndex(AShooterWeapon_Projectile* Weapon);
+
+	/** damage (server only) and effects at the impact point */
+	void Explode(int32 Index, const FHitResult& Impact);
+
+	/** spawn the explosion effect actor */
+	void SpawnExplosionEffect(TSubclassOf<AShooterExplosionEffect> ExplosionTemplate, const FHitResult& Impact);
+
+	/** remove projectile at Index, swapping the last one into its place */
+	void RemoveProjectile(int32 Index);
+
+	/** types referenced by ProjectileTypeIndices */
+	TArray<FProjectileType> ProjectileTypes;
+
+	/** per projectile state, all indexed the same way */
+	TArray<uint32> ProjectileIds;
+	TArray<int32> ProjectileTypeIndices;
+	TArray<FVector> Locations;
+	TArray<FVector> Velocities;
+	TArray<float> LifeRemaining;
+	TArray<TWeakObjectPtr<AShooterWeapon_Projectile>> Weapons;
+	TArray<TWeakObjectPtr<AActor>> Instigators;
+	TArray<TWeakObjectPtr<AController>> InstigatorControllers;
+
+	/** trail effects following the projectiles, null on dedicated servers. Pooled with manual release, so nobody else gets them while we move them */
+	UPROPERTY()
+	TArray<UParticleSystemComponent*> Trails;
+
+	/** scratch space for the batched sweeps */
+	TArray<FVector> SweepEnds;
+	TArray<const AActor*> SweepIgnoredActors;
+	TArray<FHitResult> SweepHits;
+	TArray<uint8> SweepBlocked;
+
+	/** [client] projectiles that already exploded locally, so the server's report can be ignored */
+	TArray<uint32> RecentlyExplodedIds;
+
+	uint32 NextProjectileId;
+};
@@ -467,6 +467,9 @@ protected:
 	/** [local] weapon specific fire implementation */
 	virtual void FireWeapon() PURE_VIRTUAL(AShooterWeapon::FireWeapon,);
 
+	/** [server] called once for every shot fired, whether the owner is local, remote or AI */
+	virtual void OnServerFired() {}
+
 	/** [server] fire & update ammo */
 	UFUNCTION(reliable, server, WithValidation)
 	void ServerHandleFiring();
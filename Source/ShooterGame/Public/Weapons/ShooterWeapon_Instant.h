@@ -59,10 +59,18 @@ struct FInstantWeaponData
 	UPROPERTY(EditDefaultsOnly, Category=HitVerification)
 	float ClientSideHitLeeway;
 
+	/** hit verification: distance (cm) a hit may be outside the rewound capsule of a character (see p.LagCompensation.Enable) */
+	UPROPERTY(EditDefaultsOnly, Category=HitVerification)
+	float LagCompensationTolerance;
+
 	/** hit verification: threshold for dot product between view direction and hit direction */
 	UPROPERTY(EditDefaultsOnly, Category=HitVerification)
 	float AllowedViewDotHitDir;
 
+	/** loudness of a shot heard by AI listeners (dB) */
+	UPROPERTY(EditDefaultsOnly, Category=Sound)
+	float FireLoudnessDb;
+
 	/** defaults */
 	FInstantWeaponData()
 	{
@@ -74,7 +82,9 @@ struct FInstantWeaponData
 		HitDamage = 10;
 		DamageType = UDamageType::StaticClass();
 		ClientSideHitLeeway = 200.0f;
+		LagCompensationTolerance = 50.0f;
 		AllowedViewDotHitDir = 0.8f;
+		FireLoudnessDb = 0.0f;
 	}
 };
 
@@ -87,6 +97,9 @@ class AShooterWeapon_Instant : public AShooterWeapon
 	/** get current spread */
 	float GetCurrentSpread() const;
 
+	/** [server] result of validating a client reported hit with UShooterLagCompensation */
+	void OnLagCompensatedHitValidated(const FHitResult& Impact, const FVector& ShootDir, int32 RandomSeed, float ReticleSpread, bool bConfirmed);
+
 protected:
 
 	virtual EAmmoType GetAmmoType() const override
@@ -122,7 +135,7 @@ protected:
 
 	/** server notified of hit from client to verify */
 	UFUNCTION(reliable, server, WithValidation)
-	void ServerNotifyHit(const FHitResult& Impact, FVector_NetQuantizeNormal ShootDir, int32 RandomSeed, float ReticleSpread);
+	void ServerNotifyHit(const FHitResult& Impact, FVector_NetQuantizeNormal ShootDir, int32 RandomSeed, float ReticleSpread, float ClientTimestamp);
 
 	/** server notified of miss to show trail FX */
 	UFUNCTION(unreliable, server, WithValidation)
@@ -143,6 +156,9 @@ protected:
 	/** [local] weapon specific fire implementation */
 	virtual void FireWeapon() override;
 
+	/** [server] let AI listeners hear the shot */
+	virtual void OnServerFired() override;
+
 	/** [local + server] update spread on firing */
 	virtual void OnBurstFinished() override;
 
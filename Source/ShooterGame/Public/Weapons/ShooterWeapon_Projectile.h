@@ -51,6 +51,10 @@ class AShooterWeapon_Projectile : public AShooterWeapon
 	/** apply config on projectile */
 	void ApplyWeaponConfig(FProjectileWeaponData& Data);
 
+	/** [server] a projectile simulated by UShooterProjectileManager exploded */
+	UFUNCTION(reliable, NetMulticast)
+	void MulticastProjectileExploded(uint32 ProjectileId, FVector_NetQuantize ImpactPoint, FVector_NetQuantizeNormal ImpactNormal);
+
 protected:
 
 	virtual EAmmoType GetAmmoType() const override
@@ -71,4 +75,8 @@ protected:
 	/** spawn projectile on server */
 	UFUNCTION(reliable, server, WithValidation)
 	void ServerFireProjectile(FVector Origin, FVector_NetQuantizeNormal ShootDir);
+
+	/** start simulating a projectile in UShooterProjectileManager everywhere; replaces spawning a replicated actor */
+	UFUNCTION(unreliable, NetMulticast)
+	void MulticastFireProjectile(uint32 ProjectileId, FVector_NetQuantize Origin, FVector_NetQuantizeNormal ShootDir);
 };